@@ -8,6 +8,32 @@ namespace Rizityo::AssetTool
 		using namespace Math;
 		using namespace DirectX;
 
+		using IndexRefs = Vector<uint32, true, ArenaAllocator>;
+
+		// _ƂɁA̒_QƂĂindices̈ʒuW߂
+		// ɐ𐔂arena炿傤ǂ̑傫؂ôŁA_̐q[v̊mۂN邱Ƃ͂Ȃ
+		void GatherIndexRefs(const Vector<uint32>& indices, uint32 numVertices, LinearArena& arena, OUT Vector<IndexRefs>& indexRefs)
+		{
+			const uint32 numIndices = (uint32)indices.size();
+			Vector<uint32> counts(numVertices, 0);
+			for (uint32 i = 0; i < numIndices; i++)
+			{
+				counts[indices[i]]++;
+			}
+
+			arena.Reserve(numIndices * sizeof(uint32));
+			indexRefs.reserve(numVertices);
+			for (uint32 i = 0; i < numVertices; i++)
+			{
+				indexRefs.emplace_back(ArenaAllocator{ &arena }).reserve(counts[i]);
+			}
+
+			for (uint32 i = 0; i < numIndices; i++)
+			{
+				indexRefs[indices[i]].emplace_back(i);
+			}
+		}
+
 		void RecalculateNormals(Mesh& mesh)
 		{
 			const uint32 numIndices = (uint32)mesh.RawIndices.size();
@@ -44,11 +70,9 @@ namespace Rizityo::AssetTool
 			assert(numIndices && numVertices);
 
 			mesh.Indices.resize(numIndices);
-			Vector<Vector<uint32>> indexRefs(numVertices);
-			for (uint32 i = 0; i < numIndices; i++)
-			{
-				indexRefs[mesh.RawIndices[i]].emplace_back(i);
-			}
+			LinearArena arena;
+			Vector<IndexRefs> indexRefs;
+			GatherIndexRefs(mesh.RawIndices, numVertices, arena, indexRefs);
 
 			for (uint32 i = 0; i < numVertices; i++)
 			{
@@ -100,11 +124,9 @@ namespace Rizityo::AssetTool
 			const uint32 numIndices = (uint32)oldIndices.size();
 			assert(numVertices && numIndices);
 
-			Vector<Vector<uint32>> indexRefs(numVertices);
-			for (uint32 i = 0; i < numIndices; i++)
-			{
-				indexRefs[oldIndices[i]].emplace_back(i);
-			}
+			LinearArena arena;
+			Vector<IndexRefs> indexRefs;
+			GatherIndexRefs(oldIndices, numVertices, arena, indexRefs);
 
 			for (uint32 i = 0; i < numVertices; i++)
 			{
@@ -0,0 +1,230 @@
+#include "Benchmark.h"
+#include "BoidSimulation/FlockKernel.h"
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#if defined(_WIN64)
+#include <Windows.h>
+#include <Psapi.h>
+#pragma comment(lib, "Psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Benchmark
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+		using MilliSeconds = std::chrono::duration<float64, std::milli>;
+
+		uint64 GetPeakMemoryBytes()
+		{
+#if defined(_WIN64)
+			PROCESS_MEMORY_COUNTERS counters{};
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+				return 0;
+			return counters.PeakWorkingSetSize;
+#else
+			rusage usage{};
+			if (getrusage(RUSAGE_SELF, &usage))
+				return 0;
+			return (uint64)usage.ru_maxrss * 1024; // Linuxł̓LoCgP
+#endif
+		}
+
+		// בւvlp[Z^C߂(ŋߖT)
+		float64 Percentile(const Vector<float64>& sorted, float64 percent)
+		{
+			assert(!sorted.empty());
+			const uint64 rank = (uint64)std::ceil(percent / 100.0 * (float64)sorted.size());
+			return sorted[std::max<uint64>(rank, 1) - 1];
+		}
+
+		void SummarizeFrameTimes(Vector<float64>& frameTimes, OUT BenchmarkResult& result)
+		{
+			std::sort(frameTimes.begin(), frameTimes.end());
+			float64 total = 0.0;
+			for (const float64 time : frameTimes)
+			{
+				total += time;
+			}
+			result.FrameMin = frameTimes[0];
+			result.FrameMean = total / (float64)frameTimes.size();
+			result.FrameP50 = Percentile(frameTimes, 50.0);
+			result.FrameP90 = Percentile(frameTimes, 90.0);
+			result.FrameP99 = Percentile(frameTimes, 99.0);
+			result.FrameMax = frameTimes[frameTimes.size() - 1];
+		}
+
+		// BoidSimulation::UpdateƓGeBeBȂŌJԂ
+		BenchmarkResult RunBoid(const BenchmarkConfig& config, bool parallel, float32 worldSize, OUT Vector<float64>& frameTimes)
+		{
+			const uint32 count = config.AgentCount;
+			const float32 half = worldSize / 2;
+
+			Boid::FlockBuffer buffers[2];
+			buffers[0].Resize(count);
+			std::mt19937 gen{ config.Seed };
+			std::uniform_real_distribution<float32> posDistribution(-half, half);
+			std::uniform_real_distribution<float32> dirDistribution(-1.f, 1.f);
+			for (uint32 i = 0; i < count; i++)
+			{
+				buffers[0].PosX[i] = posDistribution(gen);
+				buffers[0].PosY[i] = 0.f;
+				buffers[0].PosZ[i] = posDistribution(gen);
+
+				// BoidScriptƓx
+				const float32 dirX = dirDistribution(gen);
+				const float32 dirZ = dirDistribution(gen);
+				const float32 length = sqrtf(dirX * dirX + dirZ * dirZ);
+				const float32 speed = dirDistribution(gen) / std::max(length, Math::EPSILON);
+				buffers[0].VelX[i] = dirX * speed;
+				buffers[0].VelY[i] = 0.f;
+				buffers[0].VelZ[i] = dirZ * speed;
+			}
+
+			Boid::FlockParams params{};
+			params.AlignementWeight = 1.f;
+			params.CohesionWeight = 1.f;
+			params.SeperationWeight = 1.f;
+			params.NeighborRadius = 4.f;
+			params.SeperationRadius = 3.f;
+			params.CosFOV = cosf(20.f * Math::PI / 180.f);
+			params.MinSpeed = 2.f;
+			params.MaxSpeed = 4.f;
+			params.WallLeftX = -half;
+			params.WallRightX = half;
+			params.WallBackZ = -half;
+			params.WallForwardZ = half;
+			params.WallDistance = 5.f;
+			params.WallForceScale = 2.5f;
+
+			Spatial::SpatialHash grid;
+			Boid::FlockKernel kernel;
+			BenchmarkResult result{};
+			uint32 current = 0;
+			for (uint32 frame = 0; frame < config.WarmupFrameCount + config.FrameCount; frame++)
+			{
+				const auto start = Clock::now();
+				grid.Build(buffers[current].PosX.data(), buffers[current].PosY.data(), buffers[current].PosZ.data(), count, params.NeighborRadius);
+				kernel.Step(buffers[current], grid, params, config.DeltaTime, buffers[current ^ 1], parallel);
+				const auto end = Clock::now();
+				current ^= 1;
+
+				if (frame < config.WarmupFrameCount)
+					continue;
+
+				frameTimes.emplace_back(MilliSeconds{ end - start }.count());
+				result.Stats += kernel.Stats();
+			}
+
+			result.StateBytes = (uint64)count * sizeof(float32) * 6 * 2;
+			return result;
+		}
+
+		// SynchroSimulation::UpdateƓGeBeBȂŌJԂ
+		BenchmarkResult RunOscillator(const BenchmarkConfig& config, bool parallel, float32 worldSize, OUT Vector<float64>& frameTimes)
+		{
+			const uint32 count = config.AgentCount;
+			const float32 half = worldSize / 2;
+
+			Oscillator::OscillatorBuffer buffers[2];
+			buffers[0].Resize(count);
+			std::mt19937 gen{ config.Seed };
+			std::uniform_real_distribution<float32> posDistribution(-half, half);
+			std::uniform_real_distribution<float32> angleDistribution(0.f, Math::TWO_PI);
+			for (uint32 i = 0; i < count; i++)
+			{
+				buffers[0].PosX[i] = posDistribution(gen);
+				buffers[0].PosY[i] = 0.f;
+				buffers[0].PosZ[i] = posDistribution(gen);
+
+				// OscillatorScriptƓl
+				buffers[0].DirAngle[i] = angleDistribution(gen);
+				buffers[0].AngularFreq[i] = angleDistribution(gen) / 4;
+				buffers[0].Phase[i] = angleDistribution(gen);
+			}
+
+			Oscillator::OscillatorParams params{};
+			params.Mode = config.Coupling;
+			params.Speed = 2.f;
+			params.NeighborRadius = 4.f;
+			params.Weight = 1.f;
+			params.WallLeftX = -half;
+			params.WallRightX = half;
+			params.WallBackZ = -half;
+			params.WallForwardZ = half;
+
+			Spatial::SpatialHash grid;
+			Oscillator::OscillatorKernel kernel{ config.Seed };
+			const bool local = config.Coupling == Oscillator::CouplingMode::Local;
+			BenchmarkResult result{};
+			uint32 current = 0;
+			for (uint32 frame = 0; frame < config.WarmupFrameCount + config.FrameCount; frame++)
+			{
+				const auto start = Clock::now();
+				if (local)
+				{
+					grid.Build(buffers[current].PosX.data(), buffers[current].PosY.data(), buffers[current].PosZ.data(), count, params.NeighborRadius);
+				}
+				kernel.Step(buffers[current], local ? &grid : nullptr, params, config.DeltaTime, buffers[current ^ 1], parallel);
+				const auto end = Clock::now();
+				current ^= 1;
+
+				if (frame < config.WarmupFrameCount)
+					continue;
+
+				frameTimes.emplace_back(MilliSeconds{ end - start }.count());
+				result.Stats += kernel.Stats();
+			}
+
+			result.StateBytes = (uint64)count * sizeof(float32) * 6 * 2;
+			result.OrderParameter = kernel.OrderParameter();
+			return result;
+		}
+	}
+
+	BenchmarkResult Run(const BenchmarkConfig& config, bool parallel)
+	{
+		assert(config.AgentCount > 0 && config.FrameCount > 0);
+		assert(config.Density > 0.f);
+
+		// xɂȂ悤ɔzu͈͂L
+		const float32 worldSize = sqrtf((float32)config.AgentCount / config.Density);
+
+		Vector<float64> frameTimes;
+		frameTimes.reserve(config.FrameCount);
+
+		BenchmarkResult result{};
+		switch (config.Type)
+		{
+		case SimulationType::Boid:
+			result = RunBoid(config, parallel, worldSize, frameTimes);
+			break;
+		case SimulationType::Oscillator:
+			result = RunOscillator(config, parallel, worldSize, frameTimes);
+			break;
+		default:
+			assert(false);
+			return result;
+		}
+
+		SummarizeFrameTimes(frameTimes, result);
+		result.WorldSize = worldSize;
+		result.PeakMemoryBytes = GetPeakMemoryBytes();
+		return result;
+	}
+
+	const char* GetSimulationName(SimulationType type)
+	{
+		switch (type)
+		{
+		case SimulationType::Boid: return "boid";
+		case SimulationType::Oscillator: return "oscillator";
+		default: break;
+		}
+		return "unknown";
+	}
+}
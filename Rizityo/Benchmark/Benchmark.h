@@ -0,0 +1,52 @@
+#pragma once
+#include "CommonHeaders.h"
+#include "Core/Utility/Spatial/SpatialHash.h"
+#include "SynchroSimulation/OscillatorKernel.h"
+
+using namespace Rizityo;
+
+namespace Benchmark
+{
+	enum class SimulationType : uint32
+	{
+		Boid,
+		Oscillator,
+
+		Count
+	};
+
+	struct BenchmarkConfig
+	{
+		SimulationType Type = SimulationType::Boid;
+		uint32 AgentCount = 100;
+		uint32 FrameCount = 100;
+		uint32 WarmupFrameCount = 10; // vȂŏ̃t[
+		float32 DeltaTime = 1.f / 60.f;
+		// 1m^2̃G[WFg(V~[V̏zu 100 / 30m x 30m ɍ킹)
+		float32 Density = 100.f / (30.f * 30.f);
+		uint32 Seed = 1;
+		Oscillator::CouplingMode Coupling = Oscillator::CouplingMode::Local; // IV[^[̏ꍇ̂
+	};
+
+	struct BenchmarkResult
+	{
+		// 1t[(ԃnbV̍\z + J[l1Xebv)ɂ(~b)
+		float64 FrameMin;
+		float64 FrameMean;
+		float64 FrameP50;
+		float64 FrameP90;
+		float64 FrameP99;
+		float64 FrameMax;
+
+		Spatial::QueryStats Stats; // vt[̍v
+		float32 WorldSize; // zu`̈(m)
+		uint64 StateBytes; // G[WFg̏(_uobt@)̃oCg
+		uint64 PeakMemoryBytes; // vZX̍őgp
+		float32 OrderParameter; // Ō̃t[̒ϐ̑傫(IV[^[̏ꍇ̂)
+	};
+
+	// paralleltrueȂJobSystemŕɏ(falsȅꍇ͌ĂяõXbhŏ)
+	[[nodiscard]] BenchmarkResult Run(const BenchmarkConfig& config, bool parallel);
+
+	[[nodiscard]] const char* GetSimulationName(SimulationType type);
+}
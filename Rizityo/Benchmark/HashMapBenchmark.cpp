@@ -0,0 +1,95 @@
+#include "HashMapBenchmark.h"
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+
+namespace Benchmark
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+		using NanoSeconds = std::chrono::duration<float64, std::nano>;
+
+		// œKŏȂ悤ɒTʂ𑫂
+		volatile uint64 Sink = 0;
+
+		template<typename Map>
+		HashMapTimings Measure(const HashMapBenchmarkConfig& config, const Vector<uint64>& keys, const Vector<uint64>& shuffled, const Vector<uint64>& missing)
+		{
+			const uint32 count{ config.ElementCount };
+			Vector<float64> times[4];
+			for (uint32 i = 0; i < config.WarmupCount + config.RepeatCount; i++)
+			{
+				Map map;
+				uint64 sum = 0;
+
+				const auto start = Clock::now();
+				for (uint32 j = 0; j < count; j++)
+				{
+					map[keys[j]] = j;
+				}
+				const auto inserted = Clock::now();
+				for (uint32 j = 0; j < count; j++)
+				{
+					sum += map.find(shuffled[j])->second;
+				}
+				const auto foundHit = Clock::now();
+				for (uint32 j = 0; j < count; j++)
+				{
+					sum += map.count(missing[j]);
+				}
+				const auto foundMiss = Clock::now();
+				for (uint32 j = 0; j < count; j++)
+				{
+					map.erase(shuffled[j]);
+				}
+				const auto erased = Clock::now();
+
+				assert(map.empty() && sum == (uint64)count * (count - 1) / 2);
+				Sink = Sink + sum;
+
+				if (i < config.WarmupCount)
+					continue;
+
+				times[0].emplace_back(NanoSeconds{ inserted - start }.count() / count);
+				times[1].emplace_back(NanoSeconds{ foundHit - inserted }.count() / count);
+				times[2].emplace_back(NanoSeconds{ foundMiss - foundHit }.count() / count);
+				times[3].emplace_back(NanoSeconds{ erased - foundMiss }.count() / count);
+			}
+
+			float64 medians[4];
+			for (uint32 i = 0; i < 4; i++)
+			{
+				std::sort(times[i].begin(), times[i].end());
+				medians[i] = times[i][(times[i].size() - 1) / 2];
+			}
+			return HashMapTimings{ medians[0], medians[1], medians[2], medians[3] };
+		}
+	}
+
+	HashMapBenchmarkResult RunHashMap(const HashMapBenchmarkConfig& config)
+	{
+		assert(config.ElementCount > 0 && config.RepeatCount > 0);
+
+		// GeBeBID̂悤ɐオʃrbgɓL[ƁAǉĂȂL[𓯂
+		std::mt19937_64 gen{ config.Seed };
+		Vector<uint64> keys;
+		Vector<uint64> missing;
+		keys.reserve(config.ElementCount);
+		missing.reserve(config.ElementCount);
+		for (uint32 i = 0; i < config.ElementCount; i++)
+		{
+			const uint64 generation{ gen() & 0xff };
+			keys.emplace_back((generation << 56) | i);
+			missing.emplace_back((generation << 56) | ((uint64)config.ElementCount + i));
+		}
+		Vector<uint64> shuffled{ keys };
+		std::shuffle(shuffled.begin(), shuffled.end(), gen);
+
+		HashMapBenchmarkResult result{};
+		result.HashMap = Measure<Rizityo::HashMap<uint64, uint64>>(config, keys, shuffled, missing);
+		result.UnorderedMap = Measure<std::unordered_map<uint64, uint64>>(config, keys, shuffled, missing);
+		return result;
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "CommonHeaders.h"
+
+using namespace Rizityo;
+
+namespace Benchmark
+{
+	// HashMapstd::unordered_map𓯂L[̑Ŕׂ
+	struct HashMapBenchmarkConfig
+	{
+		uint32 ElementCount = 100'000;
+		uint32 RepeatCount = 20;
+		uint32 WarmupCount = 2; // vȂŏ̉
+		uint32 Seed = 1;
+	};
+
+	// 1삠̎(imbAJԂ̒l)
+	struct HashMapTimings
+	{
+		float64 Insert; // ̃}bvElementCountǉ(reserveȂ)
+		float64 FindHit; // ǉL[ʂ̏ԂŒT
+		float64 FindMiss; // ǉĂȂL[T
+		float64 Erase; // ǉL[Sč폜
+	};
+
+	struct HashMapBenchmarkResult
+	{
+		HashMapTimings HashMap;
+		HashMapTimings UnorderedMap;
+	};
+
+	[[nodiscard]] HashMapBenchmarkResult RunHashMap(const HashMapBenchmarkConfig& config);
+}
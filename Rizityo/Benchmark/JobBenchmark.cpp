@@ -0,0 +1,95 @@
+#include "JobBenchmark.h"
+#include "Core/Utility/Thread/JobSystem.h"
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace Benchmark
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+		using MilliSeconds = std::chrono::duration<float64, std::milli>;
+
+		template<typename Func>
+		JobTimings Measure(const JobBenchmarkConfig& config, uint32 itemCount, Func&& func)
+		{
+			Vector<float64> times;
+			times.reserve(config.RepeatCount);
+			for (uint32 i = 0; i < config.WarmupCount + config.RepeatCount; i++)
+			{
+				const auto start = Clock::now();
+				func();
+				const auto end = Clock::now();
+
+				if (i >= config.WarmupCount)
+				{
+					times.emplace_back(MilliSeconds{ end - start }.count());
+				}
+			}
+
+			std::sort(times.begin(), times.end());
+			JobTimings timings{};
+			timings.Min = times[0];
+			timings.P50 = times[(times.size() - 1) / 2];
+			timings.Max = times[times.size() - 1];
+			timings.ItemsPerSecond = timings.P50 > 0.0 ? (float64)itemCount / (timings.P50 / 1000.0) : 0.0;
+			return timings;
+		}
+	}
+
+	JobBenchmarkResult RunJobs(const JobBenchmarkConfig& config)
+	{
+		assert(config.ThreadCount >= 2 && config.RepeatCount > 0);
+		using namespace Thread;
+
+		JobSystem::Initialize(config.ThreadCount - 1);
+
+		JobBenchmarkResult result{};
+
+		result.RunWait = Measure(config, config.TaskCount, [&config]
+		{
+			std::atomic<uint32> executed{ 0 };
+			JobCounter counter;
+			for (uint32 i = 0; i < config.TaskCount; i++)
+			{
+				JobSystem::Run([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+			}
+			JobSystem::Wait(&counter);
+			assert(executed.load() == config.TaskCount);
+		});
+
+		// eWu1ÕWũJE^[0ɂȂĂ甭s
+		std::unique_ptr<JobCounter[]> counters{ std::make_unique<JobCounter[]>(config.ChainLength) };
+		result.DependencyChain = Measure(config, config.ChainLength, [&config, &counters]
+		{
+			uint32 value = 0;
+			for (uint32 i = 0; i < config.ChainLength; i++)
+			{
+				JobSystem::Run([&value, i] { assert(value == i); value++; }, &counters[i], i ? &counters[i - 1] : nullptr);
+			}
+			JobSystem::Wait(&counters[config.ChainLength - 1]);
+			assert(value == config.ChainLength);
+		});
+
+		Vector<float32> values(config.ElementCount);
+		for (uint32 i = 0; i < config.ElementCount; i++)
+		{
+			values[i] = (float32)i;
+		}
+		result.ParallelFor = Measure(config, config.ElementCount, [&config, &values]
+		{
+			JobSystem::ParallelFor(config.ElementCount, config.ChunkSize, [&values](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; i++)
+				{
+					values[i] = sqrtf(values[i] * values[i] + 1.f);
+				}
+			});
+		});
+
+		JobSystem::Shutdown();
+		return result;
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "CommonHeaders.h"
+
+using namespace Rizityo;
+
+namespace Benchmark
+{
+	// WuVXễI[o[wbhƃXP[O𑪂
+	struct JobBenchmarkConfig
+	{
+		uint32 ThreadCount = 2; // Ăяo(CXbh)܂߂Xbh(2ȏ)
+		uint32 RepeatCount = 100;
+		uint32 WarmupCount = 10; // vȂŏ̉
+		uint32 TaskCount = 10'000; // Run + WaitŔs̃Wu̐
+		uint32 ChainLength = 1'000; // ˑ֌WłȂWu̒
+		uint32 ElementCount = 1 << 20; // ParallelFor̗vf
+		uint32 ChunkSize = 1'024;
+	};
+
+	struct JobTimings
+	{
+		float64 Min; // 1񂠂̎(~b)
+		float64 P50;
+		float64 Max;
+		float64 ItemsPerSecond; // P50狁߂1b̏
+	};
+
+	struct JobBenchmarkResult
+	{
+		JobTimings RunWait; // ̃WuTaskCountsđ҂
+		JobTimings DependencyChain; // ÕWũJE^[ɈˑWuChainLengthȂ
+		JobTimings ParallelFor; // ElementCountvf̌yvZɍs
+	};
+
+	// WuVXeČvAII
+	[[nodiscard]] JobBenchmarkResult RunJobs(const JobBenchmarkConfig& config);
+}
@@ -0,0 +1,308 @@
+#include "Benchmark.h"
+#include "JobBenchmark.h"
+#include "HashMapBenchmark.h"
+#include "Core/Utility/Thread/JobSystem.h"
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#if defined(_WIN64)
+#pragma comment(lib, "Engine.lib")
+#endif
+
+// EBhEGPUg킸ɃV~[ṼJ[l񂵂āAʂJSONŕWo͂ɏo
+//
+// g: Benchmark [--sim boid|oscillator|all|jobs|hashmap] [--counts 100,1000,...] [--frames N] [--warmup N]
+//                   [--threads N] [--density D] [--dt T] [--seed S] [--coupling local|meanfield]
+// --threads͌Ăяo܂߂Xbh(0͘_RAA1̓[J[gȂ)
+// --sim jobs̏ꍇ̓V~[V̑ɃWuVXe2Xbh--threads܂Ŕ{Xɑ₵Čv
+// --sim hashmap̏ꍇ--counts̗vfƂHashMapstd::unordered_mapׂ(--frames͌JԂ)
+
+using namespace Rizityo;
+
+namespace
+{
+	constexpr uint32 DefaultCounts[]{ 100, 1'000, 10'000, 100'000, 1'000'000 };
+
+	struct Options
+	{
+		bool RunBoid = true;
+		bool RunOscillator = true;
+		bool RunJobs = false;
+		bool RunHashMap = false;
+		Vector<uint32> Counts;
+		Benchmark::BenchmarkConfig Config{};
+		uint32 ThreadCount = 0;
+	};
+
+	void PrintUsage()
+	{
+		fprintf(stderr, "usage: Benchmark [--sim boid|oscillator|all|jobs|hashmap] [--counts 100,1000,...] [--frames N] [--warmup N]\n"
+						"                 [--threads N] [--density D] [--dt T] [--seed S] [--coupling local|meanfield]\n");
+	}
+
+	bool ParseCounts(const char* text, OUT Vector<uint32>& counts)
+	{
+		counts.clear();
+		while (*text)
+		{
+			char* end = nullptr;
+			const unsigned long count = strtoul(text, &end, 10);
+			if (end == text || !count)
+				return false;
+
+			counts.emplace_back((uint32)count);
+			text = (*end == ',') ? end + 1 : end;
+		}
+		return !counts.empty();
+	}
+
+	bool ParseOptions(int argc, char* argv[], OUT Options& options)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const char* const name = argv[i];
+			if (i + 1 >= argc)
+				return false;
+			const char* const value = argv[++i];
+
+			if (!strcmp(name, "--sim"))
+			{
+				options.RunBoid = !strcmp(value, "boid") || !strcmp(value, "all");
+				options.RunOscillator = !strcmp(value, "oscillator") || !strcmp(value, "all");
+				options.RunJobs = !strcmp(value, "jobs");
+				options.RunHashMap = !strcmp(value, "hashmap");
+				if (!options.RunBoid && !options.RunOscillator && !options.RunJobs && !options.RunHashMap)
+					return false;
+			}
+			else if (!strcmp(name, "--counts"))
+			{
+				if (!ParseCounts(value, options.Counts))
+					return false;
+			}
+			else if (!strcmp(name, "--frames"))
+			{
+				options.Config.FrameCount = (uint32)strtoul(value, nullptr, 10);
+				if (!options.Config.FrameCount)
+					return false;
+			}
+			else if (!strcmp(name, "--warmup"))
+			{
+				options.Config.WarmupFrameCount = (uint32)strtoul(value, nullptr, 10);
+			}
+			else if (!strcmp(name, "--threads"))
+			{
+				options.ThreadCount = (uint32)strtoul(value, nullptr, 10);
+			}
+			else if (!strcmp(name, "--density"))
+			{
+				options.Config.Density = strtof(value, nullptr);
+				if (!(options.Config.Density > 0.f))
+					return false;
+			}
+			else if (!strcmp(name, "--dt"))
+			{
+				options.Config.DeltaTime = strtof(value, nullptr);
+			}
+			else if (!strcmp(name, "--seed"))
+			{
+				options.Config.Seed = (uint32)strtoul(value, nullptr, 10);
+			}
+			else if (!strcmp(name, "--coupling"))
+			{
+				if (!strcmp(value, "local"))
+				{
+					options.Config.Coupling = Oscillator::CouplingMode::Local;
+				}
+				else if (!strcmp(value, "meanfield"))
+				{
+					options.Config.Coupling = Oscillator::CouplingMode::MeanField;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		if (options.Counts.empty())
+		{
+			for (const uint32 count : DefaultCounts)
+			{
+				options.Counts.emplace_back(count);
+			}
+		}
+
+		if (!options.ThreadCount)
+		{
+			options.ThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		return true;
+	}
+
+	void PrintResult(const Benchmark::BenchmarkConfig& config, const Benchmark::BenchmarkResult& result, bool last)
+	{
+		const float64 frames = (float64)config.FrameCount;
+		const Spatial::QueryStats& stats{ result.Stats };
+		printf("    {\n");
+		printf("      \"simulation\": \"%s\",\n", Benchmark::GetSimulationName(config.Type));
+		printf("      \"agents\": %u,\n", config.AgentCount);
+		printf("      \"world_size\": %.3f,\n", result.WorldSize);
+		if (config.Type == Benchmark::SimulationType::Oscillator)
+		{
+			printf("      \"coupling\": \"%s\",\n", config.Coupling == Oscillator::CouplingMode::MeanField ? "meanfield" : "local");
+			printf("      \"order_parameter\": %.4f,\n", result.OrderParameter);
+		}
+		printf("      \"frame_ms\": { \"min\": %.4f, \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n",
+			   result.FrameMin, result.FrameMean, result.FrameP50, result.FrameP90, result.FrameP99, result.FrameMax);
+		printf("      \"neighbor_queries\": { \"queries_per_frame\": %.1f, \"candidates_per_frame\": %.1f, \"neighbors_per_frame\": %.1f, \"neighbors_per_query\": %.3f },\n",
+			   (float64)stats.QueryCount / frames, (float64)stats.CandidateCount / frames, (float64)stats.NeighborCount / frames,
+			   stats.QueryCount ? (float64)stats.NeighborCount / (float64)stats.QueryCount : 0.0);
+		printf("      \"memory\": { \"state_bytes\": %llu, \"peak_process_bytes\": %llu }\n",
+			   (unsigned long long)result.StateBytes, (unsigned long long)result.PeakMemoryBytes);
+		printf("    }%s\n", last ? "" : ",");
+	}
+
+	void PrintTimings(const char* name, const Benchmark::JobTimings& timings, bool last)
+	{
+		printf("      \"%s\": { \"min_ms\": %.4f, \"p50_ms\": %.4f, \"max_ms\": %.4f, \"items_per_second\": %.1f }%s\n",
+			   name, timings.Min, timings.P50, timings.Max, timings.ItemsPerSecond, last ? "" : ",");
+	}
+
+	// Xbh2{Xɑ₵ăWuVXev
+	int RunJobBenchmark(const Options& options)
+	{
+		Vector<uint32> threadCounts;
+		for (uint32 count = 2; count < options.ThreadCount; count *= 2)
+		{
+			threadCounts.emplace_back(count);
+		}
+		threadCounts.emplace_back(std::max(options.ThreadCount, 2u));
+
+		Benchmark::JobBenchmarkConfig config{};
+		config.RepeatCount = options.Config.FrameCount;
+		config.WarmupCount = options.Config.WarmupFrameCount;
+
+		printf("{\n");
+		printf("  \"repeats\": %u,\n", config.RepeatCount);
+		printf("  \"tasks\": %u,\n", config.TaskCount);
+		printf("  \"chain_length\": %u,\n", config.ChainLength);
+		printf("  \"parallel_for\": { \"elements\": %u, \"chunk_size\": %u },\n", config.ElementCount, config.ChunkSize);
+		printf("  \"runs\": [\n");
+		for (uint32 i = 0; i < threadCounts.size(); i++)
+		{
+			config.ThreadCount = threadCounts[i];
+			const Benchmark::JobBenchmarkResult result{ Benchmark::RunJobs(config) };
+			printf("    {\n");
+			printf("      \"threads\": %u,\n", config.ThreadCount);
+			PrintTimings("run_wait", result.RunWait, false);
+			PrintTimings("dependency_chain", result.DependencyChain, false);
+			PrintTimings("parallel_for", result.ParallelFor, true);
+			printf("    }%s\n", i + 1 == threadCounts.size() ? "" : ",");
+			fflush(stdout);
+		}
+		printf("  ]\n");
+		printf("}\n");
+		return 0;
+	}
+
+	void PrintHashMapTimings(const char* name, const Benchmark::HashMapTimings& timings, bool last)
+	{
+		printf("      \"%s\": { \"insert_ns\": %.2f, \"find_hit_ns\": %.2f, \"find_miss_ns\": %.2f, \"erase_ns\": %.2f }%s\n",
+			   name, timings.Insert, timings.FindHit, timings.FindMiss, timings.Erase, last ? "" : ",");
+	}
+
+	// vfƂHashMapstd::unordered_map1삠̎Ԃv
+	int RunHashMapBenchmark(const Options& options)
+	{
+		Benchmark::HashMapBenchmarkConfig config{};
+		config.RepeatCount = options.Config.FrameCount;
+		config.WarmupCount = options.Config.WarmupFrameCount;
+		config.Seed = options.Config.Seed;
+
+		printf("{\n");
+		printf("  \"repeats\": %u,\n", config.RepeatCount);
+		printf("  \"runs\": [\n");
+		for (uint32 i = 0; i < options.Counts.size(); i++)
+		{
+			config.ElementCount = options.Counts[i];
+			const Benchmark::HashMapBenchmarkResult result{ Benchmark::RunHashMap(config) };
+			printf("    {\n");
+			printf("      \"elements\": %u,\n", config.ElementCount);
+			PrintHashMapTimings("hash_map", result.HashMap, false);
+			PrintHashMapTimings("unordered_map", result.UnorderedMap, true);
+			printf("    }%s\n", i + 1 == options.Counts.size() ? "" : ",");
+			fflush(stdout);
+		}
+		printf("  ]\n");
+		printf("}\n");
+		return 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options{};
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	if (options.RunJobs)
+		return RunJobBenchmark(options);
+
+	if (options.RunHashMap)
+		return RunHashMapBenchmark(options);
+
+	// ĂяõXbhɎQ̂Ń[J[1ȂĂ悢
+	const bool parallel{ options.ThreadCount > 1 };
+	if (parallel)
+	{
+		Thread::JobSystem::Initialize(options.ThreadCount - 1);
+	}
+
+	Vector<Benchmark::BenchmarkConfig> configs;
+	for (uint32 type = 0; type < (uint32)Benchmark::SimulationType::Count; type++)
+	{
+		const Benchmark::SimulationType simType = (Benchmark::SimulationType)type;
+		if ((simType == Benchmark::SimulationType::Boid && !options.RunBoid) ||
+			(simType == Benchmark::SimulationType::Oscillator && !options.RunOscillator))
+			continue;
+
+		for (const uint32 count : options.Counts)
+		{
+			Benchmark::BenchmarkConfig config{ options.Config };
+			config.Type = simType;
+			config.AgentCount = count;
+			configs.emplace_back(config);
+		}
+	}
+
+	printf("{\n");
+	printf("  \"threads\": %u,\n", options.ThreadCount);
+	printf("  \"frames\": %u,\n", options.Config.FrameCount);
+	printf("  \"warmup_frames\": %u,\n", options.Config.WarmupFrameCount);
+	printf("  \"dt\": %.6f,\n", options.Config.DeltaTime);
+	printf("  \"density\": %.6f,\n", options.Config.Density);
+	printf("  \"runs\": [\n");
+	for (uint32 i = 0; i < configs.size(); i++)
+	{
+		const Benchmark::BenchmarkResult result{ Benchmark::Run(configs[i], parallel) };
+		PrintResult(configs[i], result, i + 1 == configs.size());
+		fflush(stdout);
+	}
+	printf("  ]\n");
+	printf("}\n");
+
+	if (parallel)
+	{
+		Thread::JobSystem::Shutdown();
+	}
+	return 0;
+}
@@ -32,6 +32,60 @@ namespace Rizityo
 		};
 
 		Entity Spawn(const char* entityName, const Math::Vector3& pos = {}, const Math::Vector3& rot = {});
+
+		// E폜L^ĂAXNvg̍XVIɂ܂Ƃ߂Ďs
+		// XNvgUpdate̒(ɍXVĂꍇ܂)ł͂g
+		void SpawnDeferred(const char* entityName, const Math::Vector3& pos = {}, const Math::Vector3& rot = {});
+		void RemoveDeferred(EntityID id);
+
+		// [U[`̃R|[lg
+		// GeBeB͎ĂR|[lg̑gݍ킹(A[L^Cv)Ƃɂ܂Ƃ߂ĒuAǉE폜ƕʂ̃A[L^CvɈڂ
+		// ڂƂmemcpyŃRs[̂ŁAgrAɃRs[ł^Ɍ
+		using ComponentTypeID = uint32;
+
+		namespace Internal
+		{
+			ComponentTypeID RegisterComponentType(uint32 size, uint32 alignment);
+			// ǉ̈()Ԃ
+			[[nodiscard]] void* AddComponent(EntityID id, ComponentTypeID type);
+			void RemoveComponent(EntityID id, ComponentTypeID type);
+			// ĂȂnullptrԂ
+			[[nodiscard]] void* GetComponent(EntityID id, ComponentTypeID type);
+
+			template<typename T>
+			ComponentTypeID GetComponentTypeID()
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "R|[lg̓grAɃRs[ł^łȂ΂܂");
+				static_assert(alignof(T) <= alignof(std::max_align_t), "mallocŊmۂłACg𒴂Ă܂");
+				static const ComponentTypeID type{ RegisterComponentType((uint32)sizeof(T), (uint32)alignof(T)) };
+				return type;
+			}
+		}
+
+		template<typename T>
+		T& AddComponent(Entity entity, const T& value = {})
+		{
+			return *new (Internal::AddComponent(entity.ID(), Internal::GetComponentTypeID<T>())) T(value);
+		}
+
+		template<typename T>
+		void RemoveComponent(Entity entity)
+		{
+			Internal::RemoveComponent(entity.ID(), Internal::GetComponentTypeID<T>());
+		}
+
+		// ĂȂnullptrԂ(AhX̓GeBeB̐E폜ER|[lg̒ǉE폜ŕς)
+		template<typename T>
+		[[nodiscard]] T* GetComponent(Entity entity)
+		{
+			return static_cast<T*>(Internal::GetComponent(entity.ID(), Internal::GetComponentTypeID<T>()));
+		}
+
+		template<typename T>
+		[[nodiscard]] bool HasComponent(Entity entity)
+		{
+			return GetComponent<T>(entity) != nullptr;
+		}
 	}
 
 	namespace Script
@@ -67,7 +121,21 @@ namespace Rizityo
 
 		namespace Internal
 		{
-			using ScriptPtr = std::unique_ptr<EntityScript>;
+			// XNvg𐶐XuɕԂ
+			struct ScriptDeleter
+			{
+				using DestroyFunc = void(*)(EntityScript*);
+
+				DestroyFunc Destroy = nullptr;
+
+				void operator()(EntityScript* const script) const
+				{
+					assert(Destroy);
+					Destroy(script);
+				}
+			};
+
+			using ScriptPtr = std::unique_ptr<EntityScript, ScriptDeleter>;
 			using ScriptCreateFunc = ScriptPtr(*)(GameEntity::Entity entity);
 			using StringHash = std::hash<std::string>;
 
@@ -78,11 +146,248 @@ namespace Rizityo
 #endif // USE_EDITOR
 			ScriptCreateFunc GetScriptCreateFunc(size_t tag);
 
+			// XNvgNXƂ̃Xu(^̃XNvg̓y[W̒ŗׂ荇)
+			template<class ScriptClass>
+			SlabPool<ScriptClass>& GetScriptSlab()
+			{
+				static SlabPool<ScriptClass> slab;
+				return slab;
+			}
+
+			template<class ScriptClass>
+			void DestroyScript(EntityScript* const script)
+			{
+				GetScriptSlab<ScriptClass>().Delete(static_cast<ScriptClass*>(script));
+			}
+
 			template<class ScriptClass>
 			ScriptPtr CreateScript(GameEntity::Entity entity)
 			{
 				assert(entity.IsValid());
-				return std::make_unique<ScriptClass>(entity);
+				return ScriptPtr{ GetScriptSlab<ScriptClass>().New(entity), ScriptDeleter{ &DestroyScript<ScriptClass> } };
+			}
+
+			// static void UpdateAll(Span<ScriptClass>, float32)XNvgNX̌^Ƃ̒u
+			// vf͌Œ̑傫̃y[WɒuA폜ꏊ͎̒ǉŎg܂킷
+			// y[W͓Ȃ̂ŁAvf̃AhXƃCfbNX͍폜܂ŕςȂ
+			class ScriptPoolBase
+			{
+			public:
+
+				virtual ~ScriptPoolBase() = default;
+
+				// ǉvf̃CfbNXԂ
+				virtual uint32 Add(GameEntity::Entity entity) = 0;
+				virtual void Remove(uint32 index) = 0;
+				// count̊mۂȂŒǉł悤ɂ
+				virtual void Reserve(uint32 count) = 0;
+				[[nodiscard]] virtual EntityScript* Get(uint32 index) = 0;
+				[[nodiscard]] virtual bool IsOccupied(uint32 index) const = 0;
+				// Ăvf̐
+				[[nodiscard]] virtual uint32 Size() const = 0;
+				// ǉƂ̂CfbNX̐(폜ς݂܂)
+				[[nodiscard]] virtual uint32 Capacity() const = 0;
+				// CfbNX[begin, end)̐ĂvfUpdateAllł܂Ƃ߂čXV
+				virtual void Update(uint32 begin, uint32 end, float32 dt) = 0;
+				// UpdateAllɌĂł悢(IsParallelUpdate)
+				[[nodiscard]] virtual bool IsParallel() const = 0;
+			};
+
+			// static constexpr bool ParallelUpdate = true;XNvgNXUpdateEUpdateAllJobSystemŕɌĂ΂
+			// ̏ꍇAUpdateEUpdateAll̒ł͎̃GeBeBւ̏(SetPositionȂ)Ɠǂݍ݂s
+			// ȂNX̓CXbhŏɍXV
+			template<class ScriptClass, typename = void>
+			struct IsParallelUpdate : std::false_type {};
+
+			template<class ScriptClass>
+			struct IsParallelUpdate<ScriptClass, std::void_t<decltype(ScriptClass::ParallelUpdate)>> : std::bool_constant<ScriptClass::ParallelUpdate> {};
+
+			// y[W̒ŘAĐĂvf1SpanɂUpdateAllɓn
+			// PageSize̓XNvg̍XṼ`N(64)̔{Ȃ̂ŁA`Ny[W܂Ƃ͂Ȃ
+			template<class ScriptClass, uint32 PageSize = 256>
+			class ScriptPool final : public ScriptPoolBase
+			{
+				static_assert(PageSize && PageSize % 64 == 0);
+				static_assert(alignof(ScriptClass) <= alignof(std::max_align_t), "mallocŊmۂłACg𒴂Ă܂");
+
+			public:
+				ScriptPool() = default;
+				ScriptPool(const ScriptPool&) = delete;
+				ScriptPool& operator=(const ScriptPool&) = delete;
+
+				~ScriptPool()
+				{
+					for (uint32 i = 0; i < _Count; i++)
+					{
+						if (IsOccupied(i))
+						{
+							GetItem(i).~ScriptClass();
+						}
+					}
+					for (ScriptClass* const page : _Pages)
+					{
+						free(page);
+					}
+				}
+
+				uint32 Add(GameEntity::Entity entity) override
+				{
+					assert(entity.IsValid());
+					uint32 index = UINT32_INVALID_NUM;
+					if (_FreeIndices.empty())
+					{
+						index = _Count++;
+						if (index / PageSize >= _Pages.size())
+						{
+							AddPage();
+						}
+						if (index / 64 >= _Occupancy.size())
+						{
+							_Occupancy.emplace_back(0);
+						}
+					}
+					else
+					{
+						index = _FreeIndices.back();
+						_FreeIndices.resize(_FreeIndices.size() - 1);
+					}
+
+					assert(!IsOccupied(index));
+					new (&GetItem(index)) ScriptClass(entity);
+					_Occupancy[index / 64] |= (uint64)1 << (index % 64);
+					_Size++;
+					return index;
+				}
+
+				void Remove(uint32 index) override
+				{
+					assert(IsOccupied(index));
+					GetItem(index).~ScriptClass();
+					_Occupancy[index / 64] &= ~((uint64)1 << (index % 64));
+					_FreeIndices.emplace_back(index);
+					_Size--;
+				}
+
+				void Reserve(uint32 count) override
+				{
+					// 󂢂Ăꏊg܂킹Ȃꍇł悤Ɋmۂ
+					const uint64 capacity{ (uint64)_Count + count };
+					while (_Pages.size() * PageSize < capacity)
+					{
+						AddPage();
+					}
+					_Occupancy.reserve((capacity + 63) / 64);
+					_FreeIndices.reserve(capacity);
+				}
+
+				[[nodiscard]] EntityScript* Get(uint32 index) override
+				{
+					assert(IsOccupied(index));
+					return &GetItem(index);
+				}
+
+				[[nodiscard]] bool IsOccupied(uint32 index) const override
+				{
+					return index < _Count && ((_Occupancy[index / 64] >> (index % 64)) & 1);
+				}
+
+				[[nodiscard]] uint32 Size() const override
+				{
+					return _Size;
+				}
+
+				[[nodiscard]] uint32 Capacity() const override
+				{
+					return _Count;
+				}
+
+				void Update(uint32 begin, uint32 end, float32 dt) override
+				{
+					assert(begin <= end && end <= _Count);
+					uint32 index{ begin };
+					while (index < end)
+					{
+						if (!IsOccupied(index))
+						{
+							index++;
+							continue;
+						}
+
+						// y[W̏I肩󂢂Ăꏊ܂ł܂Ƃ߂
+						const uint32 pageEnd{ std::min(end, (index / PageSize + 1) * PageSize) };
+						uint32 runEnd{ index + 1 };
+						while (runEnd < pageEnd && IsOccupied(runEnd))
+						{
+							runEnd++;
+						}
+						ScriptClass::UpdateAll(Span<ScriptClass>{ &GetItem(index), runEnd - index }, dt);
+						index = runEnd;
+					}
+				}
+
+				[[nodiscard]] bool IsParallel() const override
+				{
+					return IsParallelUpdate<ScriptClass>::value;
+				}
+
+			private:
+				Vector<ScriptClass*> _Pages;
+				Vector<uint64> _Occupancy; // 1rbg1vf(Ă1)
+				Vector<uint32> _FreeIndices; // 폜ꏊ(납g)
+				uint32 _Count = 0;
+				uint32 _Size = 0;
+
+				[[nodiscard]] ScriptClass& GetItem(uint32 index)
+				{
+					assert(index < _Count);
+					return _Pages[index / PageSize][index % PageSize];
+				}
+
+				void AddPage()
+				{
+					ScriptClass* const page{ static_cast<ScriptClass*>(malloc(sizeof(ScriptClass) * PageSize)) };
+					assert(page);
+					_Pages.emplace_back(page);
+				}
+			};
+
+			template<class ScriptClass, typename = void>
+			struct HasUpdateAll : std::false_type {};
+
+			template<class ScriptClass>
+			struct HasUpdateAll<ScriptClass, std::void_t<decltype(ScriptClass::UpdateAll(std::declval<Span<ScriptClass>>(), 0.f))>> : std::true_type {};
+
+			uint8 AddScriptPool(ScriptCreateFunc func, ScriptPoolBase* pool); // funcŐXNvgpoolɒu悤ɓo^
+
+			// UpdateAllNX^Ƃ̒uo^(ȂNX͌ʂɐUpdateĂ)
+			template<class ScriptClass>
+			uint8 RegisterScriptPool()
+			{
+				if constexpr (HasUpdateAll<ScriptClass>::value)
+				{
+					static ScriptPool<ScriptClass> pool;
+					return AddScriptPool(&CreateScript<ScriptClass>, &pool);
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			uint8 AddParallelScript(ScriptCreateFunc func); // funcŐXNvgUpdateɌĂԂ悤ɓo^
+
+			// UpdateAllParallelUpdatew肵NXo^(UpdateAllNX̓v[񂩂ǂ)
+			template<class ScriptClass>
+			uint8 RegisterParallelScript()
+			{
+				if constexpr (IsParallelUpdate<ScriptClass>::value && !HasUpdateAll<ScriptClass>::value)
+				{
+					return AddParallelScript(&CreateScript<ScriptClass>);
+				}
+				else
+				{
+					return false;
+				}
 			}
 
 #ifdef USE_EDITOR
@@ -95,6 +400,10 @@ namespace Rizityo
 					= Rizityo::Script::Internal::RegisterScript(				  \
 						Rizityo::Script::Internal::StringHash()(#TYPE),           \
 						&Rizityo::Script::Internal::CreateScript<TYPE>);		  \
+				const uint8 _Pool_##TYPE                                          \
+					= Rizityo::Script::Internal::RegisterScriptPool<TYPE>();      \
+				const uint8 _Parallel_##TYPE                                      \
+					= Rizityo::Script::Internal::RegisterParallelScript<TYPE>();  \
 				const uint8 _Name_##TYPE                                          \
 					= Rizityo::Script::Internal::AddScriptName(#TYPE);			  \
 			}                                                                     
@@ -108,6 +417,10 @@ namespace Rizityo
 					= Rizityo::Script::Internal::RegisterScript(				  \
 						Rizityo::Script::Internal::StringHash()(#TYPE),           \
 						&Rizityo::Script::Internal::CreateScript<TYPE>);		  \
+				const uint8 _Pool_##TYPE                                          \
+					= Rizityo::Script::Internal::RegisterScriptPool<TYPE>();      \
+				const uint8 _Parallel_##TYPE                                      \
+					= Rizityo::Script::Internal::RegisterParallelScript<TYPE>();  \
 			}
 
 #endif // USE_EDITOR
@@ -19,4 +19,5 @@ constexpr uint32 UINT32_INVALID_NUM{ 0xffff'ffff };
 constexpr uint16 UINT16_INVALID_NUM{ 0xffff };
 constexpr uint8 UINT8_INVALID_NUM{ 0xff };
 
-using float32 = float;
\ No newline at end of file
+using float32 = float;
+using float64 = double;
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "Archetype.h"
+
+namespace Rizityo::GameEntity
+{
+	namespace
+	{
+		// o^ꂽɕׂ(Internal::GetComponentTypeID̐ÓIȏĂ΂̂Ŋ֐staticɂ)
+		Vector<ComponentTypeInfo>& ComponentTypes()
+		{
+			static Vector<ComponentTypeInfo> types;
+			return types;
+		}
+
+	} // ϐ
+
+	namespace
+	{
+		[[nodiscard]] constexpr uint32 AlignUp(uint32 value, uint32 alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		// capacitysuƂ̃`N̑傫(offsetsnƊëʒu)
+		uint32 CalculateChunkLayout(const Vector<ComponentTypeID>& types, uint32 capacity, uint32* const offsets = nullptr)
+		{
+			uint32 size{ (uint32)sizeof(EntityID) * capacity };
+			for (const ComponentTypeID type : types)
+			{
+				const ComponentTypeInfo& info{ GetComponentTypeInfo(type) };
+				size = AlignUp(size, info.Alignment);
+				if (offsets)
+				{
+					offsets[type] = size;
+				}
+				size += info.Size * capacity;
+			}
+			return size;
+		}
+
+	} // ֐
+
+	namespace Internal
+	{
+		ComponentTypeID RegisterComponentType(uint32 size, uint32 alignment)
+		{
+			Vector<ComponentTypeInfo>& types{ ComponentTypes() };
+			assert(types.size() < MaxComponentTypes);
+			assert(size && alignment && (alignment & (alignment - 1)) == 0);
+			types.emplace_back(ComponentTypeInfo{ size, alignment });
+			return (ComponentTypeID)types.size() - 1;
+		}
+	}
+
+	const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeID type)
+	{
+		assert(type < ComponentTypes().size());
+		return ComponentTypes()[type];
+	}
+
+	Archetype::Archetype(ComponentMask mask) : _Mask{ mask }
+	{
+		for (ComponentTypeID type = 0; type < MaxComponentTypes; type++)
+		{
+			_ColumnOffsets[type] = UINT32_INVALID_NUM;
+			if (mask & GetComponentMask(type))
+			{
+				_Types.emplace_back(type);
+			}
+		}
+
+		// 1s̑傫炨悻̍s߁ÅԂ̃pfBOň镪炷
+		uint32 rowSize{ (uint32)sizeof(EntityID) };
+		for (const ComponentTypeID type : _Types)
+		{
+			rowSize += GetComponentTypeInfo(type).Size;
+		}
+		_ChunkCapacity = ChunkSize / rowSize;
+		while (_ChunkCapacity > 1 && CalculateChunkLayout(_Types, _ChunkCapacity) > ChunkSize)
+		{
+			_ChunkCapacity--;
+		}
+		assert(_ChunkCapacity && CalculateChunkLayout(_Types, _ChunkCapacity) <= ChunkSize);
+
+		CalculateChunkLayout(_Types, _ChunkCapacity, _ColumnOffsets);
+	}
+
+	Archetype::~Archetype()
+	{
+		for (const Chunk& chunk : _Chunks)
+		{
+			free(chunk.Data);
+		}
+		free(_SpareChunk);
+	}
+
+	void Archetype::Add(EntityID id, OUT uint32& chunk, OUT uint32& row)
+	{
+		if (_Chunks.empty() || _Chunks.back().Count == _ChunkCapacity)
+		{
+			uint8* const data{ _SpareChunk ? _SpareChunk : static_cast<uint8*>(malloc(ChunkSize)) };
+			assert(data);
+			_SpareChunk = nullptr;
+			_Chunks.emplace_back(Chunk{ data, 0 });
+		}
+
+		chunk = (uint32)_Chunks.size() - 1;
+		row = _Chunks.back().Count++;
+		Entities(chunk)[row] = id;
+		_Size++;
+	}
+
+	EntityID Archetype::Remove(uint32 chunk, uint32 row)
+	{
+		assert(row < Count(chunk));
+		const uint32 lastChunk{ (uint32)_Chunks.size() - 1 };
+		const uint32 lastRow{ _Chunks[lastChunk].Count - 1 };
+
+		EntityID moved{ ID::INVALID_ID };
+		if (chunk != lastChunk || row != lastRow)
+		{
+			moved = Entities(lastChunk)[lastRow];
+			Entities(chunk)[row] = moved;
+			for (const ComponentTypeID type : _Types)
+			{
+				memcpy(Get(chunk, row, type), Get(lastChunk, lastRow, type), GetComponentTypeInfo(type).Size);
+			}
+		}
+
+		// ɂȂ`N͎uΎĂAΉ
+		if (--_Chunks[lastChunk].Count == 0)
+		{
+			if (_SpareChunk)
+			{
+				free(_Chunks[lastChunk].Data);
+			}
+			else
+			{
+				_SpareChunk = _Chunks[lastChunk].Data;
+			}
+			_Chunks.resize(lastChunk);
+		}
+		_Size--;
+
+		return moved;
+	}
+}
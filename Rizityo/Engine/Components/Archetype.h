@@ -0,0 +1,102 @@
+#pragma once
+#include "ComponentsCommonHeaders.h"
+
+namespace Rizityo::GameEntity
+{
+	using ComponentMask = uint64;
+	constexpr uint32 MaxComponentTypes = 64; // ComponentMask̃rbg
+
+	struct ComponentTypeInfo
+	{
+		uint32 Size;
+		uint32 Alignment;
+	};
+
+	[[nodiscard]] const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeID type);
+
+	[[nodiscard]] constexpr ComponentMask GetComponentMask(ComponentTypeID type)
+	{
+		assert(type < MaxComponentTypes);
+		return (ComponentMask)1 << type;
+	}
+
+	// R|[lg̑gݍ킹GeBeB̒u
+	// GeBeBChunkSizeoCg̃`Nɋl߂ĒuA`N̒̓GeBeBIDƃR|[lg̎ނƂ̗(SoA)ɂ
+	// 폜ꏊɂ͍Ō̃`N̖̗vfڂ̂ŁAŌȊÕ`N͏ɖ܂Ă
+	// ɂȂ`N1ĂAɃ`NvƂɎg(ڂŒǉƍ폜JԂĂmۂƉJԂȂ)
+	// R|[lgmemcpyňڂ̂ŃRXgN^EfXgN^͌Ă΂Ȃ
+	// GW̃R|[lg(TransformEScriptERender)̗񂪎̂͊eVXẽnhŁAl͊eVXe̔zɂ
+	class Archetype
+	{
+	public:
+
+		static constexpr uint32 ChunkSize = 16 * 1024;
+
+		explicit Archetype(ComponentMask mask);
+		Archetype(const Archetype&) = delete;
+		Archetype& operator=(const Archetype&) = delete;
+		~Archetype();
+
+		// 1sǉāȀꏊԂ(R|[lg̒l͖)
+		void Add(EntityID id, OUT uint32& chunk, OUT uint32& row);
+		// s폜A󂢂ꏊɈڂGeBeBԂ(ڂĂȂINVALID_ID)
+		EntityID Remove(uint32 chunk, uint32 row);
+
+		[[nodiscard]] constexpr ComponentMask Mask() const { return _Mask; }
+		[[nodiscard]] constexpr bool Has(ComponentTypeID type) const { return (_Mask & GetComponentMask(type)) != 0; }
+		[[nodiscard]] constexpr const Vector<ComponentTypeID>& Types() const { return _Types; }
+		[[nodiscard]] constexpr uint32 ChunkCapacity() const { return _ChunkCapacity; }
+		[[nodiscard]] constexpr uint32 ChunkCount() const { return (uint32)_Chunks.size(); }
+		[[nodiscard]] constexpr uint32 Size() const { return _Size; }
+
+		[[nodiscard]] uint32 Count(uint32 chunk) const
+		{
+			assert(chunk < _Chunks.size());
+			return _Chunks[chunk].Count;
+		}
+
+		[[nodiscard]] EntityID* Entities(uint32 chunk) const
+		{
+			assert(chunk < _Chunks.size());
+			return reinterpret_cast<EntityID*>(_Chunks[chunk].Data);
+		}
+
+		// type̗̐擪(ĂȂnullptr)
+		[[nodiscard]] void* Column(uint32 chunk, ComponentTypeID type) const
+		{
+			assert(chunk < _Chunks.size() && type < MaxComponentTypes);
+			const uint32 offset{ _ColumnOffsets[type] };
+			return (offset != UINT32_INVALID_NUM) ? _Chunks[chunk].Data + offset : nullptr;
+		}
+
+		[[nodiscard]] void* Get(uint32 chunk, uint32 row, ComponentTypeID type) const
+		{
+			assert(Has(type) && row < Count(chunk));
+			return static_cast<uint8*>(Column(chunk, type)) + (uint64)row * GetComponentTypeInfo(type).Size;
+		}
+
+	private:
+
+		struct Chunk
+		{
+			uint8* Data;
+			uint32 Count;
+		};
+
+		ComponentMask _Mask;
+		Vector<ComponentTypeID> _Types; // ID̏
+		uint32 _ColumnOffsets[MaxComponentTypes]; // ^ -> `N̗̒̈ʒu(Ȃ^UINT32_INVALID_NUM)
+		uint32 _ChunkCapacity = 0;
+		uint32 _Size = 0;
+		Vector<Chunk> _Chunks; // ̃`N͎Ȃ
+		uint8* _SpareChunk = nullptr; // ɂȂ`N̎u
+	};
+
+	// GeBeB̒uꏊ
+	struct EntityLocation
+	{
+		uint32 Archetype = UINT32_INVALID_NUM; // ĂȂUINT32_INVALID_NUM
+		uint32 Chunk = 0;
+		uint32 Row = 0;
+	};
+}
@@ -2,20 +2,325 @@
 #include "Transform.h"
 #include "Script.h"
 #include "Render.h"
+#include <algorithm>
+#include <mutex>
 
 namespace Rizityo::GameEntity
 {
 	namespace
 	{
-		Vector<Transform::Component> TransformComponents;
-		Vector<Script::Component> ScriptComponents;
-		Vector<Render::Component> RenderComponents;
-
 		Vector<ID::GENERATION_TYPE> Generations;
+		Vector<EntityLocation> Locations; // GeBeBindex -> uꏊ
 		Deque<EntityID> FreeIds;
 
-		std::unordered_map<size_t, GameEntity::InitInfo*> EntityInfoMapping;
-	}
+		// A[L^Cv(x͍̂폜Ȃ̂ŁAindex͕ςȂ)
+		Vector<std::unique_ptr<Archetype>> Archetypes;
+		HashMap<ComponentMask, uint32> ArchetypeMapping; // R|[lg̑gݍ킹 -> Archetypesindex
+
+		// GW̃R|[lgA[L^Cv̗ƂĎ(l͊eVXẽR|[lg̃nh)
+		const ComponentTypeID TransformType{ Internal::GetComponentTypeID<Transform::Component>() };
+		const ComponentTypeID ScriptType{ Internal::GetComponentTypeID<Script::Component>() };
+		const ComponentTypeID RenderType{ Internal::GetComponentTypeID<Render::Component>() };
+
+		HashMap<size_t, GameEntity::InitInfo*> EntityInfoMapping;
+
+		// R}hobt@
+		// XNvg̍XVɋL^E폜ApplyCommandsł܂Ƃ߂Ďs(ɋL^̂Mutexŕی)
+		struct CreateCommand
+		{
+			// L^InitInfo͎s܂ŎcĂƂ͌Ȃ̂ŒlŎ
+			// (Render̃t@CȂǂ̓̕Rs[Ɏŵ܂܎g)
+			Transform::InitInfo Transform; // vnu̒lɍς
+			Script::InitInfo Script{};
+			Render::InitInfo Render{};
+			bool HasScript = false;
+			bool HasRender = false;
+		};
+
+		std::mutex CommandMutex;
+		Vector<CreateCommand> CreateCommands;
+		Vector<EntityID> RemoveCommands;
+
+		// SpawnManÿꎞIȔzp(ǑĂяǒ͎̕Ăяo̍ŏɂ܂Ƃ߂Ė߂Ďg܂킷)
+		LinearArena SpawnArena;
+		template<typename T>
+		using SpawnVector = Vector<T, true, ArenaAllocator>;
+
+	} // ϐ
+
+	namespace
+	{
+		InitInfo& GetEntityInfo(const char* entityName)
+		{
+			const size_t hash = Internal::StringHash()(entityName);
+			const auto iter{ EntityInfoMapping.find(hash) };
+			assert(iter != EntityInfoMapping.end());
+			return *iter->second;
+		}
+
+		void SetPositionAndRotation(Transform::InitInfo& info, const Math::Vector3& pos, const Math::Vector3& rot)
+		{
+			info.Position[0] = pos.x;
+			info.Position[1] = pos.y;
+			info.Position[2] = pos.z;
+			Math::Quaternion quat{ rot };
+			info.Rotation[0] = quat.x;
+			info.Rotation[1] = quat.y;
+			info.Rotation[2] = quat.z;
+			info.Rotation[3] = quat.w;
+		}
+
+		EntityID CreateID()
+		{
+			EntityID id;
+			if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
+			{
+				id = FreeIds.front();
+				assert(!IsAlive(id));
+				FreeIds.pop_front();
+				id = EntityID{ ID::IncrementGeneration(id) };
+				Generations[ID::GetIndex(id)]++;
+			}
+			else
+			{
+				id = EntityID{ (ID::IDType)Generations.size() };
+				Generations.push_back(0);
+				Locations.emplace_back();
+			}
+
+			return id;
+		}
+
+		// CreateIDcountĂԂ̂ƓID(g܂킷IDFreeIds܂Ƃ߂Ďo)
+		void CreateIDs(uint32 count, OUT EntityID* const ids)
+		{
+			const uint64 freeCount{ FreeIds.size() };
+			const uint32 reuseCount{ freeCount > ID::MIN_DELETED_ELEMENTS ? (uint32)std::min<uint64>(count, freeCount - ID::MIN_DELETED_ELEMENTS) : 0 };
+			PopFront(FreeIds, ids, reuseCount);
+			for (uint32 i = 0; i < reuseCount; i++)
+			{
+				assert(!IsAlive(ids[i]));
+				ids[i] = EntityID{ ID::IncrementGeneration(ids[i]) };
+				Generations[ID::GetIndex(ids[i])]++;
+			}
+
+			for (uint32 i = reuseCount; i < count; i++)
+			{
+				ids[i] = EntityID{ (ID::IDType)Generations.size() };
+				Generations.push_back(0);
+				Locations.emplace_back();
+			}
+		}
+
+		// count̃GeBeBǉƂɐLт镪zmۂALт鐔Ԃ
+		uint32 ReserveEntities(uint32 count)
+		{
+			const uint32 reusableCount{ FreeIds.size() > ID::MIN_DELETED_ELEMENTS ? (uint32)(FreeIds.size() - ID::MIN_DELETED_ELEMENTS) : 0 };
+			const uint32 newCount{ count > reusableCount ? count - reusableCount : 0 };
+			const uint64 capacity{ Generations.size() + newCount };
+			Generations.reserve(capacity);
+			Locations.reserve(capacity);
+			return newCount;
+		}
+
+		uint32 GetArchetypeIndex(ComponentMask mask)
+		{
+			const auto iter{ ArchetypeMapping.find(mask) };
+			if (iter != ArchetypeMapping.end())
+				return iter->second;
+
+			const uint32 index{ (uint32)Archetypes.size() };
+			Archetypes.emplace_back(std::make_unique<Archetype>(mask));
+			ArchetypeMapping.insert({ mask, index });
+			return index;
+		}
+
+		// idA[L^Cv̖ɒu(R|[lg̒l͖)
+		void Place(EntityID id, uint32 archetype)
+		{
+			EntityLocation& location{ Locations[ID::GetIndex(id)] };
+			assert(location.Archetype == UINT32_INVALID_NUM);
+			location.Archetype = archetype;
+			Archetypes[archetype]->Add(id, location.Chunk, location.Row);
+		}
+
+		// A[L^Cv菜A󂢂ꏊɈڂĂGeBeB̒uꏊ𒼂
+		void Unplace(ID::IDType index)
+		{
+			EntityLocation& location{ Locations[index] };
+			const EntityID moved{ Archetypes[location.Archetype]->Remove(location.Chunk, location.Row) };
+			if (ID::IsValid(moved))
+			{
+				EntityLocation& movedLocation{ Locations[ID::GetIndex(moved)] };
+				movedLocation.Chunk = location.Chunk;
+				movedLocation.Row = location.Row;
+			}
+			location = {};
+		}
+
+		[[nodiscard]] const Archetype& GetEntityArchetype(EntityID id)
+		{
+			assert(IsAlive(id));
+			return *Archetypes[Locations[ID::GetIndex(id)].Archetype];
+		}
+
+		// ĂȂnullptr
+		[[nodiscard]] void* GetComponentData(EntityID id, ComponentTypeID type)
+		{
+			const EntityLocation& location{ Locations[ID::GetIndex(id)] };
+			const Archetype& archetype{ GetEntityArchetype(id) };
+			return archetype.Has(type) ? archetype.Get(location.Chunk, location.Row, type) : nullptr;
+		}
+
+		template<typename T>
+		[[nodiscard]] T& GetComponentRef(EntityID id, ComponentTypeID type)
+		{
+			void* const data{ GetComponentData(id, type) };
+			assert(data);
+			return *static_cast<T*>(data);
+		}
+
+		// ʂ̃A[L^CvɈڂ(ɂ̒l̓Rs[AV̒l͖)
+		void MoveEntity(EntityID id, ComponentMask mask)
+		{
+			const ID::IDType index{ ID::GetIndex(id) };
+			const EntityLocation from{ Locations[index] };
+			const uint32 to{ GetArchetypeIndex(mask) };
+			assert(from.Archetype != to);
+
+			const Archetype& src{ *Archetypes[from.Archetype] };
+			Archetype& dst{ *Archetypes[to] };
+			EntityLocation location{ to, 0, 0 };
+			dst.Add(id, location.Chunk, location.Row);
+			for (const ComponentTypeID type : dst.Types())
+			{
+				if (src.Has(type))
+				{
+					memcpy(dst.Get(location.Chunk, location.Row, type), src.Get(from.Chunk, from.Row, type), GetComponentTypeInfo(type).Size);
+				}
+			}
+
+			Unplace(index);
+			Locations[index] = location;
+		}
+
+		// GW̃R|[lg͍OɎQƂ邱Ƃ̂ŁAȃnhŖ߂Ă
+		template<typename T>
+		void ClearComponent(EntityID id, ComponentTypeID type)
+		{
+			new (&GetComponentRef<T>(id, type)) T{};
+		}
+
+		[[nodiscard]] ComponentMask GetEntityMask(bool hasScript, bool hasRender)
+		{
+			ComponentMask mask{ GetComponentMask(TransformType) };
+			mask |= hasScript ? GetComponentMask(ScriptType) : 0;
+			mask |= hasRender ? GetComponentMask(RenderType) : 0;
+			return mask;
+		}
+
+		Entity CreateEntity(const Transform::InitInfo& transform, const Script::InitInfo* const script, const Render::InitInfo* const render)
+		{
+			const bool hasScript{ script && script->CreateFunc };
+			const bool hasRender{ render != nullptr };
+
+			const Entity newEntity{ CreateID() };
+			const EntityID id{ newEntity.ID() };
+			Place(id, GetArchetypeIndex(GetEntityMask(hasScript, hasRender)));
+
+			// TransformComponent
+			ClearComponent<Transform::Component>(id, TransformType);
+			const Transform::Component transformComponent{ Transform::CreateComponent(transform, newEntity) };
+			GetComponentRef<Transform::Component>(id, TransformType) = transformComponent;
+			if (!transformComponent.IsValid())
+			{
+				Unplace(ID::GetIndex(id));
+				FreeIds.push_back(id);
+				return Entity{};
+			}
+
+			// ScriptComponent
+			if (hasScript)
+			{
+				ClearComponent<Script::Component>(id, ScriptType);
+				const Script::Component scriptComponent{ Script::CreateComponent(*script, newEntity) };
+				assert(scriptComponent.IsValid());
+				GetComponentRef<Script::Component>(id, ScriptType) = scriptComponent;
+			}
+
+			// RendererComponent
+			if (hasRender)
+			{
+				ClearComponent<Render::Component>(id, RenderType);
+				const Render::Component renderComponent{ Render::CreateComponent(*render, newEntity) };
+				assert(renderComponent.IsValid());
+				GetComponentRef<Render::Component>(id, RenderType) = renderComponent;
+			}
+
+			return newEntity;
+		}
+
+		[[nodiscard]] bool IsEngineComponentType(ComponentTypeID type)
+		{
+			return type == TransformType || type == ScriptType || type == RenderType;
+		}
+
+		[[nodiscard]] CreateCommand MakeCreateCommand(const Transform::InitInfo& transform, const Script::InitInfo* const script, const Render::InitInfo* const render)
+		{
+			CreateCommand command{};
+			command.Transform = transform;
+			if (script)
+			{
+				command.Script = *script;
+				command.HasScript = true;
+			}
+			if (render)
+			{
+				command.Render = *render;
+				command.HasRender = true;
+			}
+			return command;
+		}
+
+		void ApplyRemoveCommands()
+		{
+			// `ACeRender::RemoveComponent`Xbh`IĂ폜̂ŁAł͑҂Ȃ
+			// L^̏Ԃ̓Xbh̎sŕς̂ŁAindexɕׂFreeIdsɓ鏇Ԃɂ
+			// GeBeBL^邱Ƃ̂ŁA2ڈȍ~͐ĂȂ̂ƂĔ΂
+			std::sort(RemoveCommands.begin(), RemoveCommands.end(), [](EntityID a, EntityID b) { return ID::GetIndex(a) < ID::GetIndex(b); });
+			for (const EntityID id : RemoveCommands)
+			{
+				if (IsAlive(id))
+				{
+					RemoveGameEnity(id);
+				}
+			}
+			RemoveCommands.clear();
+		}
+
+		void ApplyCreateCommands()
+		{
+			// g܂킹IDőȂzL΂̂ŁAɂ܂Ƃ߂ĊmۂĂ
+			Transform::Reserve(ReserveEntities((uint32)CreateCommands.size()));
+
+			uint32 scriptCount = 0, renderCount = 0;
+			for (const CreateCommand& command : CreateCommands)
+			{
+				scriptCount += (command.HasScript && command.Script.CreateFunc) ? 1 : 0;
+				renderCount += command.HasRender ? 1 : 0;
+			}
+			Script::Reserve(scriptCount);
+			Render::Reserve(renderCount);
+
+			for (const CreateCommand& command : CreateCommands)
+			{
+				const Entity entity{ CreateEntity(command.Transform, command.HasScript ? &command.Script : nullptr, command.HasRender ? &command.Render : nullptr) };
+				assert(entity.IsValid());
+			}
+			CreateCommands.clear();
+		}
+
+	} // ֐
 
 	namespace Internal
 	{
@@ -33,74 +338,53 @@ namespace Rizityo::GameEntity
 		if (!info.Transform)
 			return Entity{};
 
-		// ID
-		EntityID id;
-		if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
-		{
-			id = FreeIds.front();
-			assert(!IsAlive(id));
-			FreeIds.pop_front();
-			id = EntityID{ ID::IncrementGeneration(id) };
-			Generations[ID::GetIndex(id)]++;
-		}
-		else
-		{
-			id = EntityID{ (ID::IDType)Generations.size() };
-			Generations.push_back(0);
-
-			TransformComponents.emplace_back();
-			ScriptComponents.emplace_back();
-			RenderComponents.emplace_back();
-		}
+		return CreateEntity(*info.Transform, info.Script, info.Render);
+	}
 
-		const Entity newEntity{ id };
-		const ID::IDType index{ ID::GetIndex(id) };
+	void CreateGameEntityDeferred(const InitInfo& info)
+	{
+		assert(info.Transform);
+		if (!info.Transform)
+			return;
 
-		// TransformComponent
-		assert(!TransformComponents[index].IsValid());
-		TransformComponents[index] = Transform::CreateComponent(*info.Transform, newEntity);
-		if (!TransformComponents[index].IsValid())
-			return Entity{};
+		// }eA̔z̃Rs[̓bN̊Oōς܂Ă
+		CreateCommand command{ MakeCreateCommand(*info.Transform, info.Script, info.Render) };
+		std::lock_guard lock{ CommandMutex };
+		CreateCommands.emplace_back(std::move(command));
+	}
 
-		// ScriptComponent
-		if (info.Script && info.Script->CreateFunc)
+	void ApplyCommands()
+	{
+		// _ŌĂԂ̂ŋL^ĂXbh͂Ȃ
+		if (!RemoveCommands.empty())
 		{
-			assert(!ScriptComponents[index].IsValid());
-			ScriptComponents[index] = Script::CreateComponent(*info.Script, newEntity);
-			assert(ScriptComponents[index].IsValid());
+			ApplyRemoveCommands();
 		}
 
-		// RendererComponent
-		if (info.Render)
+		if (!CreateCommands.empty())
 		{
-			assert(!RenderComponents[index].IsValid());
-			RenderComponents[index] = Render::CreateComponent(*info.Render, newEntity);
-			assert(RenderComponents[index].IsValid());
+			ApplyCreateCommands();
 		}
-
-		return newEntity;
 	}
 
 	void RemoveGameEnity(EntityID id)
 	{
 		assert(IsAlive(id));
-		ID::IDType index{ ID::GetIndex(id) };
+		const Archetype& archetype{ GetEntityArchetype(id) };
 
-		Transform::RemoveComponent(TransformComponents[index]);
-		TransformComponents[index] = {};
+		Transform::RemoveComponent(GetComponentRef<Transform::Component>(id, TransformType));
 
-		if (ScriptComponents[index].IsValid())
+		if (archetype.Has(ScriptType))
 		{
-			Script::RemoveComponent(ScriptComponents[index]);
-			ScriptComponents[index] = {};
+			Script::RemoveComponent(GetComponentRef<Script::Component>(id, ScriptType));
 		}
 
-		if (RenderComponents[index].IsValid())
+		if (archetype.Has(RenderType))
 		{
-			Render::RemoveComponent(RenderComponents[index]);
-			RenderComponents[index] = {};
+			Render::RemoveComponent(GetComponentRef<Render::Component>(id, RenderType));
 		}
 
+		Unplace(ID::GetIndex(id));
 		FreeIds.push_back(id);
 	}
 
@@ -109,36 +393,199 @@ namespace Rizityo::GameEntity
 		assert(ID::IsValid(id));
 		ID::IDType index{ ID::GetIndex(id) };
 		assert(index < Generations.size());
-		return (Generations[index] == ID::GetGeneration(id) && TransformComponents[index].IsValid());
+		return (Generations[index] == ID::GetGeneration(id) && Locations[index].Archetype != UINT32_INVALID_NUM);
+	}
+
+	void AddScript(EntityID id, const Script::InitInfo& info)
+	{
+		assert(info.CreateFunc);
+		const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+		assert(!(mask & GetComponentMask(ScriptType)));
+		MoveEntity(id, mask | GetComponentMask(ScriptType));
+		ClearComponent<Script::Component>(id, ScriptType);
+		GetComponentRef<Script::Component>(id, ScriptType) = Script::CreateComponent(info, Entity{ id });
+	}
+
+	void RemoveScript(EntityID id)
+	{
+		const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+		assert(mask & GetComponentMask(ScriptType));
+		Script::RemoveComponent(GetComponentRef<Script::Component>(id, ScriptType));
+		MoveEntity(id, mask & ~GetComponentMask(ScriptType));
+	}
+
+	void AddRender(EntityID id, const Render::InitInfo& info)
+	{
+		const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+		assert(!(mask & GetComponentMask(RenderType)));
+		MoveEntity(id, mask | GetComponentMask(RenderType));
+		ClearComponent<Render::Component>(id, RenderType);
+		GetComponentRef<Render::Component>(id, RenderType) = Render::CreateComponent(info, Entity{ id });
+	}
+
+	void RemoveRender(EntityID id)
+	{
+		const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+		assert(mask & GetComponentMask(RenderType));
+		Render::RemoveComponent(GetComponentRef<Render::Component>(id, RenderType));
+		MoveEntity(id, mask & ~GetComponentMask(RenderType));
+	}
+
+	uint32 GetArchetypeCount()
+	{
+		return (uint32)Archetypes.size();
+	}
+
+	const Archetype& GetArchetype(uint32 index)
+	{
+		assert(index < Archetypes.size());
+		return *Archetypes[index];
+	}
+
+	namespace Internal
+	{
+		void* AddComponent(EntityID id, ComponentTypeID type)
+		{
+			assert(!IsEngineComponentType(type));
+			const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+			assert(!(mask & GetComponentMask(type)));
+			MoveEntity(id, mask | GetComponentMask(type));
+			return GetComponentData(id, type);
+		}
+
+		void RemoveComponent(EntityID id, ComponentTypeID type)
+		{
+			assert(!IsEngineComponentType(type));
+			const ComponentMask mask{ GetEntityArchetype(id).Mask() };
+			assert(mask & GetComponentMask(type));
+			MoveEntity(id, mask & ~GetComponentMask(type));
+		}
+
+		void* GetComponent(EntityID id, ComponentTypeID type)
+		{
+			return GetComponentData(id, type);
+		}
 	}
 
 	Transform::Component Entity::GetTransformComponent() const
 	{
-		assert(IsAlive(_ID));
-		const ID::IDType index{ ID::GetIndex(_ID) };
-		return TransformComponents[index];
+		return GetComponentRef<Transform::Component>(_ID, TransformType);
 	}
 
 	Script::Component Entity::GetScriptComponent() const
 	{
-		assert(IsAlive(_ID));
-		const ID::IDType index{ ID::GetIndex(_ID) };
-		return ScriptComponents[index];
+		const void* const data{ GetComponentData(_ID, ScriptType) };
+		return data ? *static_cast<const Script::Component*>(data) : Script::Component{};
 	}
 
 	Entity Spawn(const char* entityName, const Math::Vector3& pos /*= {}*/, const Math::Vector3& rot /*= {}*/)
 	{
-		size_t hash = Internal::StringHash()(entityName);
-		assert(EntityInfoMapping.find(hash) != EntityInfoMapping.end());
-		InitInfo& info{ *EntityInfoMapping[hash] };
-		info.Transform->Position[0] = pos.x;
-		info.Transform->Position[1] = pos.y;
-		info.Transform->Position[2] = pos.z;
-		Math::Quaternion quat{ rot };
-		info.Transform->Rotation[0] = quat.x;
-		info.Transform->Rotation[1] = quat.y;
-		info.Transform->Rotation[2] = quat.z;
-		info.Transform->Rotation[3] = quat.w;
-		return CreateGameEntity(info);
+		const InitInfo& info{ GetEntityInfo(entityName) };
+		assert(info.Transform);
+		Transform::InitInfo transform{ *info.Transform };
+		SetPositionAndRotation(transform, pos, rot);
+		return CreateEntity(transform, info.Script, info.Render);
+	}
+
+	const InitInfo* FindPrefab(const char* entityName)
+	{
+		return &GetEntityInfo(entityName);
+	}
+
+	void SpawnMany(const InitInfo* const prefab, uint32 count, const Math::Vector3* const positions,
+		const Math::Quaternion* const rotations /*= nullptr*/, OUT Entity* const entities /*= nullptr*/)
+	{
+		assert(prefab && prefab->Transform);
+		if (!count)
+			return;
+
+		// ID(g܂킷̂AV͖̂ɘAĕ)
+		// SēA[L^CvȂ̂ŁA`N̒łĕ
+		const bool hasScript{ prefab->Script && prefab->Script->CreateFunc };
+		const bool hasRender{ prefab->Render != nullptr };
+		const uint32 archetype{ GetArchetypeIndex(GetEntityMask(hasScript, hasRender)) };
+		Transform::Reserve(ReserveEntities(count));
+
+		// ꎞIȔz͑SSpawnArena؂o(Kvȑ傫ɊmۂĂ)
+		SpawnArena.Reset();
+		constexpr uint64 bytesPerEntity{ sizeof(EntityID) + sizeof(Entity) + sizeof(Transform::Component) + sizeof(Script::Component) + sizeof(Render::Component) };
+		SpawnArena.Reserve(bytesPerEntity * count + alignof(std::max_align_t) * 5);
+		const ArenaAllocator scratch{ &SpawnArena };
+
+		SpawnVector<EntityID> ids(count, scratch);
+		CreateIDs(count, ids.data());
+		SpawnVector<Entity> newEntities(count, scratch);
+		for (uint32 i = 0; i < count; i++)
+		{
+			const EntityID id{ ids[i] };
+			newEntities[i] = Entity{ id };
+			Place(id, archetype);
+			ClearComponent<Transform::Component>(id, TransformType);
+			if (hasScript)
+			{
+				ClearComponent<Script::Component>(id, ScriptType);
+			}
+			if (hasRender)
+			{
+				ClearComponent<Render::Component>(id, RenderType);
+			}
+		}
+
+		// eR|[lg͎ނƂɂ܂Ƃ߂č
+		// positionsErotationsȂSpawnƓ_E]Ȃɂ
+		Transform::InitInfo transform{ *prefab->Transform };
+		SetPositionAndRotation(transform, {}, {});
+		SpawnVector<Transform::Component> transforms(count, scratch);
+		Transform::CreateComponents(transform, newEntities.data(), count, positions, rotations, transforms.data());
+		for (uint32 i = 0; i < count; i++)
+		{
+			assert(transforms[i].IsValid());
+			GetComponentRef<Transform::Component>(newEntities[i].ID(), TransformType) = transforms[i];
+		}
+
+		if (hasScript)
+		{
+			SpawnVector<Script::Component> scripts(count, scratch);
+			Script::CreateComponents(*prefab->Script, newEntities.data(), count, scripts.data());
+			for (uint32 i = 0; i < count; i++)
+			{
+				assert(scripts[i].IsValid());
+				GetComponentRef<Script::Component>(newEntities[i].ID(), ScriptType) = scripts[i];
+			}
+		}
+
+		if (hasRender)
+		{
+			SpawnVector<Render::Component> renders(count, scratch);
+			Render::CreateComponents(*prefab->Render, newEntities.data(), count, renders.data());
+			for (uint32 i = 0; i < count; i++)
+			{
+				assert(renders[i].IsValid());
+				GetComponentRef<Render::Component>(newEntities[i].ID(), RenderType) = renders[i];
+			}
+		}
+
+		if (entities)
+		{
+			memcpy(entities, newEntities.data(), sizeof(Entity) * count);
+		}
+	}
+
+	void SpawnDeferred(const char* entityName, const Math::Vector3& pos /*= {}*/, const Math::Vector3& rot /*= {}*/)
+	{
+		const InitInfo& info{ GetEntityInfo(entityName) };
+		assert(info.Transform);
+		CreateCommand command{ MakeCreateCommand(*info.Transform, info.Script, info.Render) };
+		SetPositionAndRotation(command.Transform, pos, rot);
+
+		std::lock_guard lock{ CommandMutex };
+		CreateCommands.emplace_back(std::move(command));
+	}
+
+	void RemoveDeferred(EntityID id)
+	{
+		assert(IsAlive(id));
+		std::lock_guard lock{ CommandMutex };
+		RemoveCommands.emplace_back(id);
 	}
 }
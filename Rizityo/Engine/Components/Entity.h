@@ -1,5 +1,6 @@
 #pragma once
 #include "ComponentsCommonHeaders.h"
+#include "Archetype.h"
 
 namespace Rizityo
 {
@@ -24,6 +25,52 @@ namespace Rizityo
 		Entity CreateGameEntity(const InitInfo& info); // TODO?: QƓnlnɂ
 		void RemoveGameEnity(EntityID id);
 		bool IsAlive(EntityID id);
+
+		// Oœo^(ÕnbV𖈉vZȂ悤ɁA܂Ƃ߂ĐO1񂾂Ă)
+		[[nodiscard]] const InitInfo* FindPrefab(const char* entityName);
+		// prefab̃GeBeBcount܂Ƃ߂Đ
+		// positionsErotationscount̔zŁAnullptȑꍇ͌_E]Ȃɂ(vnu̒l͏Ȃ)
+		// z͂܂Ƃ߂ĊmۂAR|[lg͎ނƂɂ܂Ƃ߂čBentitiesnƐGeBeB
+		void SpawnMany(const InitInfo* const prefab, uint32 count, const Math::Vector3* const positions,
+			const Math::Quaternion* const rotations = nullptr, OUT Entity* const entities = nullptr);
+
+		// ɃXNvgE`̃R|[lgǉE폜(GeBeB͕ʂ̃A[L^CvɈڂ)
+		void AddScript(EntityID id, const Script::InitInfo& info);
+		void RemoveScript(EntityID id);
+		void AddRender(EntityID id, const Render::InitInfo& info);
+		void RemoveRender(EntityID id);
+
+		// A[L^Cv͈xƍ폜Ȃ̂ŁAindex͕ςȂ
+		[[nodiscard]] uint32 GetArchetypeCount();
+		[[nodiscard]] const Archetype& GetArchetype(uint32 index);
+
+		// required̃R|[lgSĎA[L^Cṽ`Nfunc(const Archetype&, uint32 chunk)ɓn
+		// `N̗̒͘AĂ̂ŁAgR|[lg̗񂾂ǂݏł
+		// func̒ŃGeBeB̐E폜R|[lg̒ǉE폜Ȃ
+		template<typename Func>
+		void ForEachChunk(ComponentMask required, Func&& func)
+		{
+			const uint32 archetypeCount{ GetArchetypeCount() };
+			for (uint32 i = 0; i < archetypeCount; i++)
+			{
+				const Archetype& archetype{ GetArchetype(i) };
+				if ((archetype.Mask() & required) != required)
+					continue;
+
+				const uint32 chunkCount{ archetype.ChunkCount() };
+				for (uint32 chunk = 0; chunk < chunkCount; chunk++)
+				{
+					func(archetype, chunk);
+				}
+			}
+		}
+
+		// L^AApplyCommandsł܂Ƃ߂Ďs(info̎wTransformEScriptERender͒lŃRs[̂ŌĂяoɔjĂ悢)
+		// Render::InitInfõt@CȂǂ̓̕Rs[Ȃ̂ŁAw͎s܂ŎcĂ
+		void CreateGameEntityDeferred(const InitInfo& info);
+		// L^E폜s
+		// XNvg̍XV̌ȂǁAL^ĂXbhȂ_ŌĂ(폜܂ޏꍇ͕`Xbh̕`悪Î҂)
+		void ApplyCommands();
 	
 		namespace Internal
 		{
@@ -0,0 +1,102 @@
+#pragma once
+#include "Entity.h"
+#include <tuple>
+
+namespace Rizityo::GameEntity
+{
+	// NG1`N(GeBeBIDTs̗)
+	// ͘AĂ̂ŁAlɒu[U[`̃R|[lgSpan̂܂SIMDł܂Ƃ߂ďł
+	// Transform::ComponentȂǃGW̃R|[lg̗̓nhȂ̂ŁAl͊eVXe̔z񂩂ƂɂȂ
+	// (`Ñnh̏Ԃ͊eVXe̔z̏ԂƊ֌WȂ̂ŁA̓ǂݏ͔єтɂȂ)
+	template<typename... Ts>
+	class QueryChunk
+	{
+	public:
+
+		QueryChunk(const Archetype& archetype, uint32 chunk)
+			: _Entities{ archetype.Entities(chunk) }, _Count{ archetype.Count(chunk) },
+			_Columns{ static_cast<Ts*>(archetype.Column(chunk, Internal::GetComponentTypeID<Ts>()))... }
+		{
+			assert(((std::get<Ts*>(_Columns) != nullptr) && ...));
+		}
+
+		[[nodiscard]] constexpr uint32 Size() const { return _Count; }
+
+		[[nodiscard]] constexpr Span<const EntityID> Entities() const
+		{
+			return Span<const EntityID>{ _Entities, _Count };
+		}
+
+		// TTŝǂꂩ
+		template<typename T>
+		[[nodiscard]] constexpr Span<T> Column() const
+		{
+			return Span<T>{ std::get<T*>(_Columns), _Count };
+		}
+
+	private:
+
+		const EntityID* _Entities;
+		uint32 _Count;
+		std::tuple<Ts*...> _Columns;
+	};
+
+	// Ts̃R|[lgSĎGeBeB̃`N̈ꗗ
+	// _̃`NW߂̂ŁAgI܂ŃGeBeB̐E폜R|[lg̒ǉE폜Ȃ
+	// `NƂɓƗĂ̂ŁAParallelForŃ`NPʂɕďł
+	template<typename... Ts>
+	class Query
+	{
+	public:
+
+		Query()
+		{
+			static_assert(sizeof...(Ts) > 0);
+			const ComponentMask required{ (GetComponentMask(Internal::GetComponentTypeID<Ts>()) | ...) };
+			ForEachChunk(required, [this](const Archetype& archetype, uint32 chunk)
+			{
+				_Chunks.emplace_back(archetype, chunk);
+				_EntityCount += archetype.Count(chunk);
+			});
+		}
+
+		[[nodiscard]] constexpr uint32 ChunkCount() const { return (uint32)_Chunks.size(); }
+		[[nodiscard]] constexpr uint32 EntityCount() const { return _EntityCount; }
+		[[nodiscard]] constexpr const QueryChunk<Ts...>& operator[](uint32 index) const { return _Chunks[index]; }
+		[[nodiscard]] constexpr const QueryChunk<Ts...>* begin() const { return _Chunks.begin(); }
+		[[nodiscard]] constexpr const QueryChunk<Ts...>* end() const { return _Chunks.end(); }
+
+	private:
+
+		Vector<QueryChunk<Ts...>> _Chunks;
+		uint32 _EntityCount = 0;
+	};
+
+	// Ts̃R|[lgSĎGeBeBƂfunc(Ts&...)܂func(Entity, Ts&...)Ă
+	// GeBeBƂIsAliveindeẍ͂A`N̗O珇ɓǂ
+	// (GW̃R|[lg̓nhn邾Ȃ̂ŁAlǂނQueryChunkƓєтɂȂ)
+	// func̒ŃGeBeB̐E폜R|[lg̒ǉE폜Ȃ(L^Deferred̊֐g)
+	template<typename... Ts, typename Func>
+	void ForEach(Func&& func)
+	{
+		static_assert(sizeof...(Ts) > 0);
+		const ComponentMask required{ (GetComponentMask(Internal::GetComponentTypeID<Ts>()) | ...) };
+		ForEachChunk(required, [&func](const Archetype& archetype, uint32 chunk)
+		{
+			const EntityID* const entities{ archetype.Entities(chunk) };
+			const uint32 count{ archetype.Count(chunk) };
+			const std::tuple<Ts*...> columns{ static_cast<Ts*>(archetype.Column(chunk, Internal::GetComponentTypeID<Ts>()))... };
+			for (uint32 i = 0; i < count; i++)
+			{
+				if constexpr (std::is_invocable_v<Func&, Entity, Ts&...>)
+				{
+					func(Entity{ entities[i] }, std::get<Ts*>(columns)[i]...);
+				}
+				else
+				{
+					func(std::get<Ts*>(columns)[i]...);
+				}
+			}
+		});
+	}
+}
@@ -1,6 +1,9 @@
 #include "Render.h"
+#include "Transform.h"
 #include "Content/AssetToEngine.h"
 #include "Core/Utility/IO/FileIO.h"
+#include "Core/Utility/Thread/JobSystem.h"
+#include "Graphics/RenderThread.h"
 
 namespace Rizityo::Render
 {
@@ -8,21 +11,21 @@ namespace Rizityo::Render
 	{
 		Vector<ID::IDType> RenderItemIDs;
 		Vector<ID::IDType> RenderID_ItemIndex_Mapping; // RenderIDindex -> RenderItemIDsindex
-		std::unordered_map<ID::IDType, ID::IDType> ItemRenderID_Mapping; // RenderItemID -> RenderID
+		HashMap<ID::IDType, ID::IDType> ItemRenderID_Mapping; // RenderItemID -> RenderID
 
 		Vector<float32> Thresholds;
 
 		Vector<ID::GENERATION_TYPE> Generations;
 		Deque<RenderID> FreeIds;
 
-		std::unordered_map<size_t, ID::IDType> ModelID_Mapping;
+		HashMap<size_t, ID::IDType> ModelID_Mapping;
 
 		// Q[NɃRpCĒǉ
 		// TODO? : 炩߃RpCVF[_[ǂݍ
 		// hash(t@C/֐) -> VF[_[ID
-		std::unordered_map<size_t, ID::IDType> ShaderID_Mapping;
+		HashMap<size_t, ID::IDType> ShaderID_Mapping;
 
-		std::unordered_map<size_t, ID::IDType> MaterialID_Mapping;
+		HashMap<size_t, ID::IDType> MaterialID_Mapping;
 
 		using StringHash = std::hash<std::string>;
 	}
@@ -57,78 +60,131 @@ namespace Rizityo::Render
 		}
 	}
 
-	Render::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity)
+	namespace
 	{
-		assert(entity.IsValid());
-
-		RenderID id;
-		if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
+		RenderID CreateID()
 		{
-			id = FreeIds.front();
-			assert(!Exists(id));
-			FreeIds.pop_front();
-			id = RenderID{ ID::IncrementGeneration(id) };
-			Generations[ID::GetIndex(id)]++;
-		}
-		else
-		{
-			id = RenderID{ (ID::IDType)Generations.size() };
-			Generations.push_back(0);
-			RenderID_ItemIndex_Mapping.emplace_back();
-		}
-
-		assert(ID::IsValid(id));
+			RenderID id;
+			if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
+			{
+				id = FreeIds.front();
+				assert(!Exists(id));
+				FreeIds.pop_front();
+				id = RenderID{ ID::IncrementGeneration(id) };
+				Generations[ID::GetIndex(id)]++;
+			}
+			else
+			{
+				id = RenderID{ (ID::IDType)Generations.size() };
+				Generations.push_back(0);
+				RenderID_ItemIndex_Mapping.emplace_back();
+			}
 
-		// modelID쐬
-		size_t modelFileHash = StringHash()(info.ModelName);
-		ID::IDType modelID{};
-		std::shared_ptr<std::thread> _model;
-		if (ModelID_Mapping.find(modelFileHash) != ModelID_Mapping.end())
-		{
-			modelID = ModelID_Mapping[modelFileHash];
+			assert(ID::IsValid(id));
+			return id;
 		}
-		else
+
+		// `ACeidɌѕt
+		void AddItem(RenderID id, ID::IDType itemID)
 		{
-			_model = std::make_shared<std::thread>([&] {LoadModel(info.ModelFilePath, modelFileHash, modelID); });
+			RenderItemIDs.emplace_back(itemID);
+			Thresholds.emplace_back(1.f); // TODO : thresholds̕ύX
+
+			const ID::IDType renderItemIndex{ (ID::IDType)RenderItemIDs.size() - 1 };
+			RenderID_ItemIndex_Mapping[ID::GetIndex(id)] = renderItemIndex;
+			ItemRenderID_Mapping[itemID] = id;
 		}
 
-		// materialID쐬
-		// TODO? : }eAVF[_[Ɠlɂ炩߃[hĂǂ
-		const uint32 materialCount = info.MaterialCount;
-		Vector<ID::IDType> materials(materialCount);
-		for (uint32 i = 0; i < materialCount; i++)
+		// fƃ}eAID߂(܂ĂȂ΍)
+		void GetModelAndMaterials(const InitInfo& info, OUT ID::IDType& modelID, OUT Vector<ID::IDType>& materials)
 		{
-			const MaterialInfo& mInfo{ info.MaterialsInfo[i] };
-			size_t materialHash = StringHash()(mInfo.MaterialName);
-			// łɃ}eAĂꍇ͂p
-			if (MaterialID_Mapping.find(materialHash) != MaterialID_Mapping.end())
+			// modelID쐬
+			size_t modelFileHash = StringHash()(info.ModelName);
+			Thread::JobCounter modelCounter;
+			if (ModelID_Mapping.find(modelFileHash) != ModelID_Mapping.end())
 			{
-				materials[i] = MaterialID_Mapping[materialHash];
-				continue;
+				modelID = ModelID_Mapping[modelFileHash];
 			}
-			const ID::IDType vsID{ ShaderID_Mapping[HashShaderName(mInfo.ShadersInfo[ShaderType::Vertex].FileName, mInfo.ShadersInfo[ShaderType::Vertex].FunctionName)] };
-			const ID::IDType psID{ ShaderID_Mapping[HashShaderName(mInfo.ShadersInfo[ShaderType::Pixel].FileName, mInfo.ShadersInfo[ShaderType::Pixel].FunctionName)] };
-			Graphics::MaterialInitInfo materialInfo{};
-			materialInfo.ShaderIDs[ShaderType::Vertex] = vsID;
-			materialInfo.ShaderIDs[ShaderType::Pixel] = psID;
-			materialInfo.Type = mInfo.Type;
-			const ID::IDType materialID = Content::CreateResource(&materialInfo, Content::AssetType::Material);
-			MaterialID_Mapping[materialHash] = materialID;
+			else
+			{
+				// }eA̍쐬ƕsăfǂݍ
+				Thread::JobSystem::Run([&] {LoadModel(info.ModelFilePath, modelFileHash, modelID); }, &modelCounter);
+			}
+
+			// materialID쐬
+			// TODO? : }eAVF[_[Ɠlɂ炩߃[hĂǂ
+			const uint32 materialCount = info.MaterialCount;
+			materials.resize(materialCount);
+			for (uint32 i = 0; i < materialCount; i++)
+			{
+				const MaterialInfo& mInfo{ info.MaterialsInfo[i] };
+				size_t materialHash = StringHash()(mInfo.MaterialName);
+				// łɃ}eAĂꍇ͂p
+				if (MaterialID_Mapping.find(materialHash) != MaterialID_Mapping.end())
+				{
+					materials[i] = MaterialID_Mapping[materialHash];
+					continue;
+				}
+				const ID::IDType vsID{ ShaderID_Mapping[HashShaderName(mInfo.ShadersInfo[ShaderType::Vertex].FileName, mInfo.ShadersInfo[ShaderType::Vertex].FunctionName)] };
+				const ID::IDType psID{ ShaderID_Mapping[HashShaderName(mInfo.ShadersInfo[ShaderType::Pixel].FileName, mInfo.ShadersInfo[ShaderType::Pixel].FunctionName)] };
+				Graphics::MaterialInitInfo materialInfo{};
+				materialInfo.ShaderIDs[ShaderType::Vertex] = vsID;
+				materialInfo.ShaderIDs[ShaderType::Pixel] = psID;
+				materialInfo.Type = mInfo.Type;
+				const ID::IDType materialID = Content::CreateResource(&materialInfo, Content::AssetType::Material);
+				MaterialID_Mapping[materialHash] = materialID;
+				materials[i] = materialID;
+			}
+
+			Thread::JobSystem::Wait(&modelCounter);
 		}
 
-		if (_model.get() != nullptr)
+	} // ֐
+
+	Render::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity)
+	{
+		assert(entity.IsValid());
+
+		const RenderID id{ CreateID() };
+
+		ID::IDType modelID{};
+		Vector<ID::IDType> materials;
+		GetModelAndMaterials(info, modelID, materials);
+
+		const ID::IDType itemID{ Graphics::AddRenderItem(entity.ID(), modelID, (uint32)materials.size(), materials.data()) };
+		AddItem(id, itemID);
+		return Render::Component{ id };
+	}
+
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count, OUT Render::Component* const components)
+	{
+		assert(entities && components);
+		if (!count)
+			return;
+
+		// fƃ}eA1񂾂߁A`ACe͂܂Ƃ߂Ēǉ
+		ID::IDType modelID{};
+		Vector<ID::IDType> materials;
+		GetModelAndMaterials(info, modelID, materials);
+
+		Vector<ID::IDType> entityIDs(count);
+		for (uint32 i = 0; i < count; i++)
 		{
-			_model->join();
+			assert(entities[i].IsValid());
+			entityIDs[i] = entities[i].ID();
 		}
 
-		ID::IDType itemID{ Graphics::AddRenderItem(entity.ID(), modelID, materialCount, materials.data()) };
-		RenderItemIDs.emplace_back(itemID);
-		Thresholds.emplace_back(1.f); // TODO : thresholds̕ύX
+		Vector<ID::IDType> itemIDs(count);
+		Graphics::AddRenderItems(entityIDs.data(), count, modelID, (uint32)materials.size(), materials.data(), itemIDs.data());
 
-		const ID::IDType renderItemIndex{ (ID::IDType)RenderItemIDs.size() - 1 };
-		RenderID_ItemIndex_Mapping[ID::GetIndex(id)] = renderItemIndex;
-		ItemRenderID_Mapping[itemID] = id;
-		return Render::Component{ id };
+		Reserve(count);
+		ItemRenderID_Mapping.reserve(ItemRenderID_Mapping.size() + count);
+		for (uint32 i = 0; i < count; i++)
+		{
+			const RenderID id{ CreateID() };
+			AddItem(id, itemIDs[i]);
+			components[i] = Render::Component{ id };
+		}
 	}
 
 	void RemoveComponent(Render::Component component)
@@ -137,7 +193,8 @@ namespace Rizityo::Render
 		const RenderID id{ component.ID() };
 		const ID::IDType itemIndex{ RenderID_ItemIndex_Mapping[ID::GetIndex(id)] };
 		const ID::IDType itemID{ RenderItemIDs[itemIndex] };
-		Graphics::RemoveRenderItem(itemID);
+		// `Xbh`ĂpPbgQƂĂ邩Ȃ̂ŁA`IĂ폜
+		Graphics::RenderThread::RemoveRenderItem(itemID);
 		const RenderID lastID{ (itemIndex != RenderItemIDs.size() - 1) ? ItemRenderID_Mapping[RenderItemIDs.back()] : id};
 		EraseUnordered(RenderItemIDs, itemIndex);
 		EraseUnordered(Thresholds, itemIndex);
@@ -146,6 +203,16 @@ namespace Rizityo::Render
 		FreeIds.push_back(id);
 	}
 
+	void Reserve(uint32 count)
+	{
+		// g܂킷IDΐLтȂA߂ɊmۂĂ
+		const uint64 capacity{ Generations.size() + count };
+		Generations.reserve(capacity);
+		RenderID_ItemIndex_Mapping.reserve(capacity);
+		RenderItemIDs.reserve(RenderItemIDs.size() + count);
+		Thresholds.reserve(Thresholds.size() + count);
+	}
+
 	// TODO : Thresholds̍XV(J̋ɍ킹)
 	void Update()
 	{
@@ -159,6 +226,23 @@ namespace Rizityo::Render
 		info.Thresholds = Thresholds.data();
 	}
 
+	void GetRenderFramePacket(OUT Graphics::FramePacket& packet)
+	{
+		packet.RenderItemIDs.resize(RenderItemIDs.size());
+		if (RenderItemIDs.size())
+		{
+			memcpy(packet.RenderItemIDs.data(), RenderItemIDs.data(), RenderItemIDs.size() * sizeof(ID::IDType));
+		}
+
+		packet.Thresholds.resize(Thresholds.size());
+		if (Thresholds.size())
+		{
+			memcpy(packet.Thresholds.data(), Thresholds.data(), Thresholds.size() * sizeof(float32));
+		}
+
+		Transform::GetAllTransformMatrices(packet.World, packet.InvWorld);
+	}
+
 	void AddShaderID(const char* fileName, const char* functionName, ID::IDType sID)
 	{
 		assert(ID::IsValid(sID));
@@ -178,12 +262,14 @@ namespace Rizityo::Render
 
 	// MeshMaterial͒ǉ̓GeBeB̍쐬
 	// 폜̓^C~ORɌ߂悤ɂ
+	// `XbhÕt[œǂłԂɉȂ悤A폜̑OFlushő҂
 	void RemoveModel(const char* modelName)
 	{
 		size_t hash = StringHash()(modelName);
 		assert(ModelID_Mapping.find(hash) != ModelID_Mapping.end());
 		const ID::IDType modelID{ ModelID_Mapping[hash] };
 		assert(ID::IsValid(modelID));
+		Graphics::RenderThread::Flush();
 		Content::DestroyResource(modelID, Content::AssetType::Mesh);
 		ModelID_Mapping.erase(hash);
 	}
@@ -194,6 +280,7 @@ namespace Rizityo::Render
 		assert(MaterialID_Mapping.find(hash) != MaterialID_Mapping.end());
 		const ID::IDType materialID{ MaterialID_Mapping[hash] };
 		assert(ID::IsValid(materialID));
+		Graphics::RenderThread::Flush();
 		Content::DestroyResource(materialID, Content::AssetType::Material);
 		MaterialID_Mapping.erase(hash);
 	}
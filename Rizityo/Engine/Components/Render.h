@@ -44,11 +44,17 @@ namespace Rizityo::Render
 	};
 
 	Render::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity);
+	// infõR|[lgcount܂Ƃ߂č(fƃ}eA1񂾂߁A`ACe͂܂Ƃ߂Ēǉ)
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count, OUT Render::Component* const components);
 	void RemoveComponent(Render::Component component);
+	// count̃R|[lgz̊mۂȂŒǉł悤ɂ
+	void Reserve(uint32 count);
 
 	void Update(); // thresholds̍XV
 
 	void GetRenderFrameInfo(OUT Graphics::FrameInfo& info);
+	// `ACeElESĂTransform̍spPbgɃRs[
+	void GetRenderFramePacket(OUT Graphics::FramePacket& packet);
 
 	void AddShaderID(const char* fileName, const char* functionName, ID::IDType vsID);
 
@@ -1,96 +1,201 @@
 #include "Script.h"
 #include "Entity.h"
 #include "Transform.h"
-
-#define USE_TRANSFORM_CACHE_MAP 0
+#include "Core/Utility/Thread/JobSystem.h"
 
 namespace Rizityo::Script
 {
 	namespace
 	{
-		Vector<Internal::ScriptPtr> EntityScripts; // Äɕۑ
-		Vector<ID::IDType> ID_Mapping; // Componentindex -> EntityScripts̏ꏊ
+		// 1t[Transform̕ύXςރobt@(ɏނ̂1Xbh)
+		// LinearArena؂ozɐς݁A肫Ȃ̓q[vɐς
+		// Reset()ŃA[i߂đÕt[̗ʂz؂ôŁAʂ΃q[v͎gȂ
+		class TransformCacheBuffer
+		{
+		public:
+			// GeBeBւ̘AύX1ɂ܂Ƃ߂
+			[[nodiscard]] Transform::ComponentCache& Get(Transform::TransformID id)
+			{
+				Transform::ComponentCache* const last{ _Overflow.size() ? &_Overflow.back() : (_Size ? &_Data[_Size - 1] : nullptr) };
+				if (last && last->ID == id)
+					return *last;
+
+				Transform::ComponentCache& cache{ (_Size < _Capacity && _Overflow.empty()) ? _Data[_Size++] : _Overflow.emplace_back() };
+				cache = Transform::ComponentCache{};
+				cache.ID = id;
+				return cache;
+			}
+
+			[[nodiscard]] constexpr uint64 Size() const { return _Size + _Overflow.size(); }
+
+			// ς񂾏dst֏oAoԂ
+			uint64 CopyTo(OUT Transform::ComponentCache* const dst) const
+			{
+				if (_Size)
+				{
+					memcpy(dst, _Data, _Size * sizeof(Transform::ComponentCache));
+				}
+				if (_Overflow.size())
+				{
+					memcpy(dst + _Size, _Overflow.data(), _Overflow.size() * sizeof(Transform::ComponentCache));
+				}
+				return Size();
+			}
+
+			void Reset()
+			{
+				const uint64 size{ Size() };
+				_Arena.Reset();
+				if (size > _Capacity)
+				{
+					_Capacity = (uint32)std::max<uint64>(size + size / 2, MinCapacity);
+					_Arena.Reserve(_Capacity * sizeof(Transform::ComponentCache));
+				}
+				if (_Capacity)
+				{
+					_Data = static_cast<Transform::ComponentCache*>(_Arena.Allocate(_Capacity * sizeof(Transform::ComponentCache), alignof(Transform::ComponentCache)));
+				}
+				_Size = 0;
+				_Overflow.clear();
+			}
+
+		private:
+			static constexpr uint32 MinCapacity = 64;
+
+			LinearArena _Arena;
+			Transform::ComponentCache* _Data = nullptr; // _Arena؂oz
+			uint32 _Size = 0;
+			uint32 _Capacity = 0;
+			Vector<Transform::ComponentCache> _Overflow; // _Dataɓ肫Ȃ(_Datǎɑ)
+		};
+
+	} // 
+
+	namespace
+	{
+		Vector<Internal::ScriptPtr> EntityScripts; // Äɕۑ(CXbhŏɍXV)
+		Vector<Internal::ScriptPtr> ParallelEntityScripts; // ParallelUpdatew肵(`NƂɕɍXV)
+		Vector<ID::IDType> ID_Mapping; // Componentindex -> EntityScriptsEParallelEntityScripts܂̓v[̒̏ꏊ
+		Vector<uint32> PoolIndices; // Componentindex -> ScriptPoolRegister::Pools̏ꏊ(v[ɒuȂꍇSerialScriptsParallelScripts)
 
 		Vector<ID::GENERATION_TYPE> Generations;
 		Deque<ScriptID> FreeIds;
 
-		Vector<Transform::ComponentCache> TransformCache;
+		TransformCacheBuffer TransformCache; // Transform::UpdateɓnύX(XNvg̍XVȊOł̕ύXɓ)
+
+		// XNvg̍XV̓`NƂ̃obt@ɏ݁AŌTransformCacheA`N̏1̔zׂ֕
+		Vector<TransformCacheBuffer> ChunkTransformCaches;
+		thread_local TransformCacheBuffer* CurrentTransformCache = nullptr;
+		LinearArena TransformUpdateArena; // ׂzp(t[߂)
 	} // ϐ
 
 	namespace
 	{
-#if USE_TRANSFORM_CACHE_MAP
-		std::unordered_map<ID::IDType, uint32> CacheMap;
-#endif
+		// ɍXVP(`N̋؂̓XbhɂȂ̂ŁATransformւ̔fςȂ)
+		constexpr uint32 ScriptChunkSize = 64;
 
-		bool Exists(ScriptID id)
-		{
-			assert(ID::IsValid(id));
-			const ID::IDType index{ ID::GetIndex(id) };
-			assert(index < Generations.size());
-			return (Generations[index] == ID::GetGeneration(id) && ID_Mapping[index] < EntityScripts.size() && EntityScripts[ID_Mapping[index]] && EntityScripts[ID_Mapping[index]]->IsValid());
-		}
+		// v[ɒuȂXNvgPoolIndices̒l
+		constexpr uint32 SerialScripts{ UINT32_INVALID_NUM }; // EntityScripts
+		constexpr uint32 ParallelScripts{ UINT32_INVALID_NUM - 1 }; // ParallelEntityScripts
+
+	} // 萔
 
-		using ScriptRegister = std::unordered_map<size_t, Internal::ScriptCreateFunc>;
+	namespace
+	{
+		using ScriptRegister = HashMap<size_t, Internal::ScriptCreateFunc>;
 		ScriptRegister& Register()
 		{
 			static ScriptRegister reg;
 			return reg;
 		}
 
-#ifdef USE_EDITOR
-		Vector<std::string>& ScriptNames()
+		// UpdateAllXNvǧ^Ƃ̒u
+		struct ScriptPoolRegister
 		{
-			static Vector<std::string> names;
-			return names;
+			Vector<Internal::ScriptPoolBase*> Pools;
+			HashMap<Internal::ScriptCreateFunc, uint32> PoolIndices; // ֐ -> Pools̏ꏊ
+		};
+
+		ScriptPoolRegister& PoolRegister()
+		{
+			static ScriptPoolRegister reg;
+			return reg;
 		}
-#endif // USE_EDITOR
 
-#if USE_TRANSFORM_CACHE_MAP
-		Transform::ComponentCache* const GetCachePtr(const GameEntity::Entity* const entity)
+		// UpdateɌĂԃXNvg̐֐
+		Vector<Internal::ScriptCreateFunc>& ParallelScriptFuncs()
 		{
-			assert(GameEntity::IsAlive((*entity).ID()));
-			const Transform::TransformID id{ (*entity).GetTransformComponent().ID() };
+			static Vector<Internal::ScriptCreateFunc> funcs;
+			return funcs;
+		}
+
+		[[nodiscard]] constexpr bool IsPoolIndex(uint32 poolIndex)
+		{
+			return poolIndex < ParallelScripts;
+		}
+
+		// v[ɒuȂXNvg̒u
+		[[nodiscard]] Vector<Internal::ScriptPtr>& GetEntityScripts(uint32 poolIndex)
+		{
+			assert(!IsPoolIndex(poolIndex));
+			return (poolIndex == ParallelScripts) ? ParallelEntityScripts : EntityScripts;
+		}
 
-			uint32 index{ UINT32_INVALID_NUM };
-			auto pair = CacheMap.try_emplace(id, ID::INVALID_ID);
+		bool Exists(ScriptID id)
+		{
+			assert(ID::IsValid(id));
+			const ID::IDType index{ ID::GetIndex(id) };
+			assert(index < Generations.size());
+			if (Generations[index] != ID::GetGeneration(id))
+				return false;
 
-			if (pair.second)
+			if (IsPoolIndex(PoolIndices[index]))
 			{
-				index = (uint32)TransformCache.size();
-				TransformCache.emplace_back();
-				TransformCache.back().ID = id;
-				CacheMap[id] = index;
+				Internal::ScriptPoolBase* const pool{ PoolRegister().Pools[PoolIndices[index]] };
+				return pool->IsOccupied(ID_Mapping[index]) && pool->Get(ID_Mapping[index])->IsValid();
 			}
-			else
+
+			const Vector<Internal::ScriptPtr>& scripts{ GetEntityScripts(PoolIndices[index]) };
+			return (ID_Mapping[index] < scripts.size() && scripts[ID_Mapping[index]] && scripts[ID_Mapping[index]]->IsValid());
+		}
+
+		[[nodiscard]] constexpr uint32 GetChunkCount(uint32 count)
+		{
+			return (count + ScriptChunkSize - 1) / ScriptChunkSize;
+		}
+
+		// [0, count)ScriptChunkSizeƂɕɍXV(`NƂ̃obt@chunkOffsetԖڂg)
+		template<typename Func>
+		void UpdateChunks(uint32 count, uint32 chunkOffset, Func&& func)
+		{
+			Thread::JobSystem::ParallelFor(count, ScriptChunkSize, [chunkOffset, &func](uint32 begin, uint32 end)
 			{
-				index = CacheMap[id];
-			}
+				// XNvg̒ő҂ĂԂɕʂ̃`N`Ƃ̂Ōɖ߂
+				TransformCacheBuffer* const previous{ CurrentTransformCache };
+				CurrentTransformCache = &ChunkTransformCaches[chunkOffset + begin / ScriptChunkSize];
+				func(begin, end);
+				CurrentTransformCache = previous;
+			});
+		}
 
-			assert(index < TransformCache.size());
-			return &TransformCache[index];
+#ifdef USE_EDITOR
+		Vector<std::string>& ScriptNames()
+		{
+			static Vector<std::string> names;
+			return names;
 		}
-#else
+#endif // USE_EDITOR
+
+		// GeBeBւ̘AύX1ɂ܂Ƃ߂
+		// Ԃɑ̃GeBeBւ̕ύXΕʂ̗vfɂȂ邪ATransform::Update͑O珇ɔf̂Ōʂ͕ςȂ
 		Transform::ComponentCache* const GetCachePtr(const GameEntity::Entity* const entity)
 		{
 			assert(GameEntity::IsAlive((*entity).ID()));
 			const Transform::TransformID id{ (*entity).GetTransformComponent().ID() };
 
-			for (auto& cache : TransformCache)
-			{
-				if (cache.ID == id)
-				{
-					return &cache;
-				}
-			}
-
-			// LbVȂ
-			TransformCache.emplace_back();
-			TransformCache.back().ID = id;
-
-			return &TransformCache.back();
+			TransformCacheBuffer& caches{ CurrentTransformCache ? *CurrentTransformCache : TransformCache };
+			return &caches.Get(id);
 		}
-#endif
 
 	} // ֐
 
@@ -103,6 +208,26 @@ namespace Rizityo::Script
 			return result;
 		}
 
+		uint8 AddScriptPool(ScriptCreateFunc func, ScriptPoolBase* pool)
+		{
+			assert(func && pool);
+			ScriptPoolRegister& reg{ PoolRegister() };
+			bool result = reg.PoolIndices.insert({ func, (uint32)reg.Pools.size() }).second;
+			assert(result);
+			if (result)
+			{
+				reg.Pools.emplace_back(pool);
+			}
+			return result;
+		}
+
+		uint8 AddParallelScript(ScriptCreateFunc func)
+		{
+			assert(func);
+			ParallelScriptFuncs().emplace_back(func);
+			return true;
+		}
+
 		ScriptCreateFunc GetScriptCreateFunc(size_t tag)
 		{
 			auto iter = Register().find(tag);
@@ -120,35 +245,96 @@ namespace Rizityo::Script
 
 	}
 
+	namespace
+	{
+		ScriptID CreateID()
+		{
+			ScriptID id;
+			if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
+			{
+				id = FreeIds.front();
+				assert(!Exists(id));
+				FreeIds.pop_front();
+				id = ScriptID{ ID::IncrementGeneration(id) };
+				Generations[ID::GetIndex(id)]++;
+			}
+			else
+			{
+				id = ScriptID{ (ID::IDType)Generations.size() };
+				Generations.push_back(0);
+				ID_Mapping.emplace_back();
+				PoolIndices.emplace_back();
+			}
+
+			assert(ID::IsValid(id));
+			return id;
+		}
+
+		// funcŐXNvguv[̏ꏊ(v[ɒuȂꍇSerialScriptsParallelScripts)
+		uint32 FindPoolIndex(Internal::ScriptCreateFunc func)
+		{
+			const ScriptPoolRegister& reg{ PoolRegister() };
+			const auto iter{ reg.PoolIndices.find(func) };
+			if (iter != reg.PoolIndices.end())
+				return iter->second;
+
+			const Vector<Internal::ScriptCreateFunc>& parallelFuncs{ ParallelScriptFuncs() };
+			return (std::find(parallelFuncs.begin(), parallelFuncs.end(), func) != parallelFuncs.end()) ? ParallelScripts : SerialScripts;
+		}
+
+		Script::Component CreateComponent(Internal::ScriptCreateFunc func, uint32 poolIndex, GameEntity::Entity entity)
+		{
+			assert(entity.IsValid());
+			const ScriptID id{ CreateID() };
+
+			if (IsPoolIndex(poolIndex))
+			{
+				Internal::ScriptPoolBase* const pool{ PoolRegister().Pools[poolIndex] };
+				const uint32 scriptIndex{ pool->Add(entity) };
+				assert(pool->Get(scriptIndex)->ID() == entity.ID());
+
+				ID_Mapping[ID::GetIndex(id)] = scriptIndex;
+				PoolIndices[ID::GetIndex(id)] = poolIndex;
+				return Script::Component{ id };
+			}
+
+			Vector<Internal::ScriptPtr>& scripts{ GetEntityScripts(poolIndex) };
+			scripts.emplace_back(func(entity));
+			assert(scripts.back()->ID() == entity.ID());
+
+			const ID::IDType entityScriptIndex{ (ID::IDType)scripts.size() - 1 };
+			ID_Mapping[ID::GetIndex(id)] = entityScriptIndex;
+			PoolIndices[ID::GetIndex(id)] = poolIndex;
+			return Script::Component{ id };
+		}
+
+	} // ֐
+
 	Script::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity)
 	{
-		assert(entity.IsValid());
 		assert(info.CreateFunc);
+		return CreateComponent(info.CreateFunc, FindPoolIndex(info.CreateFunc), entity);
+	}
 
-		ScriptID id;
-		if (FreeIds.size() > ID::MIN_DELETED_ELEMENTS) // FreeIdsȂԂŎg܂킷ƂgenerationĂ܂̂łl݂
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count, OUT Script::Component* const components)
+	{
+		assert(info.CreateFunc && entities && components);
+		const uint32 poolIndex{ FindPoolIndex(info.CreateFunc) };
+		Reserve(count);
+		if (IsPoolIndex(poolIndex))
 		{
-			id = FreeIds.front();
-			assert(!Exists(id));
-			FreeIds.pop_front();
-			id = ScriptID{ ID::IncrementGeneration(id) };
-			Generations[ID::GetIndex(id)]++;
+			PoolRegister().Pools[poolIndex]->Reserve(count);
 		}
 		else
 		{
-			id = ScriptID{ (ID::IDType)Generations.size() };
-			Generations.push_back(0);
-			ID_Mapping.emplace_back();
+			Vector<Internal::ScriptPtr>& scripts{ GetEntityScripts(poolIndex) };
+			scripts.reserve(scripts.size() + count);
 		}
 
-		assert(ID::IsValid(id));
-
-		EntityScripts.emplace_back(info.CreateFunc(entity));
-		assert(EntityScripts.back()->ID() == entity.ID());
-
-		const ID::IDType entityScriptIndex{ (ID::IDType)EntityScripts.size() - 1 };
-		ID_Mapping[ID::GetIndex(id)] = entityScriptIndex;
-		return Script::Component{ id };
+		for (uint32 i = 0; i < count; i++)
+		{
+			components[i] = CreateComponent(info.CreateFunc, poolIndex, entities[i]);
+		}
 	}
 
 	void RemoveComponent(Script::Component component)
@@ -156,28 +342,119 @@ namespace Rizityo::Script
 		assert(component.IsValid() && Exists(component.ID()));
 		const ScriptID id{ component.ID() };
 		const ID::IDType scriptEntityIndex{ ID_Mapping[ID::GetIndex(id)] };
-		const ScriptID lastID{ (scriptEntityIndex != EntityScripts.size() - 1) ? EntityScripts.back()->GetScriptComponent().ID() : id };
-		EraseUnordered(EntityScripts, scriptEntityIndex);
+		const uint32 poolIndex{ PoolIndices[ID::GetIndex(id)] };
+		if (IsPoolIndex(poolIndex))
+		{
+			// v[̗vf͓Ȃ̂ŁÃXNvgID_Mapping͂̂܂
+			PoolRegister().Pools[poolIndex]->Remove(scriptEntityIndex);
+			ID_Mapping[ID::GetIndex(id)] = ID::INVALID_ID;
+			PoolIndices[ID::GetIndex(id)] = SerialScripts;
+			FreeIds.push_back(id);
+			return;
+		}
+
+		Vector<Internal::ScriptPtr>& scripts{ GetEntityScripts(poolIndex) };
+		const ScriptID lastID{ (scriptEntityIndex != scripts.size() - 1) ? scripts.back()->GetScriptComponent().ID() : id };
+		EraseUnordered(scripts, scriptEntityIndex);
 		ID_Mapping[ID::GetIndex(lastID)] = scriptEntityIndex;
 		ID_Mapping[ID::GetIndex(id)] = ID::INVALID_ID; // vf̎id == lastIDȂ̂INVALID_ID̑
 		FreeIds.push_back(id);
 	}
 
+	void Reserve(uint32 count)
+	{
+		// g܂킷IDΐLтȂA߂ɊmۂĂ
+		const uint64 capacity{ Generations.size() + count };
+		Generations.reserve(capacity);
+		ID_Mapping.reserve(capacity);
+		PoolIndices.reserve(capacity);
+	}
+
 	void Update(float dt)
 	{
+		const Vector<Internal::ScriptPoolBase*>& pools{ PoolRegister().Pools };
+
+		// ParallelUpdatew肵ĂȂXNvg̓CXbhŏɍXV(TransformCacheɒڏ)
 		for (auto& ptr : EntityScripts)
 		{
 			ptr->Update(dt);
 		}
 
-		if (TransformCache.size())
+		for (Internal::ScriptPoolBase* const pool : pools)
+		{
+			if (!pool->IsParallel() && pool->Size())
+			{
+				pool->Update(0, pool->Capacity(), dt);
+			}
+		}
+
+		// w肵XNvg͌ʂ̂́A^Ƃ̃v[̏Ƀ`Ñobt@蓖ĂĕɍXV
+		const uint32 scriptCount{ (uint32)ParallelEntityScripts.size() };
+		uint32 chunkCount{ GetChunkCount(scriptCount) };
+		for (const Internal::ScriptPoolBase* const pool : pools)
+		{
+			if (pool->IsParallel())
+			{
+				chunkCount += GetChunkCount(pool->Capacity());
+			}
+		}
+
+		if (ChunkTransformCaches.size() < chunkCount)
 		{
-			Transform::Update(TransformCache.data(), (uint32)TransformCache.size());
-			TransformCache.clear();
+			ChunkTransformCaches.resize(chunkCount);
+		}
+
+		UpdateChunks(scriptCount, 0, [dt](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; i++)
+			{
+				ParallelEntityScripts[i]->Update(dt);
+			}
+		});
+
+		// ^ƂɃ`NPʂUpdateAllĂ(vfƂ̉z֐Ăяo͂Ȃ)
+		uint32 chunkOffset{ GetChunkCount(scriptCount) };
+		for (Internal::ScriptPoolBase* const pool : pools)
+		{
+			if (!pool->IsParallel())
+				continue;
+
+			// 폜ꏊ܂߂ăCfbNXŋ؂(󂢂ĂꏊUpdate΂)
+			const uint32 poolCapacity{ pool->Capacity() };
+			UpdateChunks(poolCapacity, chunkOffset, [pool, dt](uint32 begin, uint32 end)
+			{
+				pool->Update(begin, end, dt);
+			});
+			chunkOffset += GetChunkCount(poolCapacity);
+		}
+		assert(chunkOffset == chunkCount);
 
-#if USE_TRANSFORM_CACHE_MAP
-			CacheMap.clear();
-#endif
+		// TransformCachěɃ`Nɕׂ(ɍXVXNvg̕ύX̌ɔf)
+		uint64 cacheCount{ TransformCache.Size() };
+		for (uint32 i = 0; i < chunkCount; i++)
+		{
+			cacheCount += ChunkTransformCaches[i].Size();
+		}
+
+		if (cacheCount)
+		{
+			TransformUpdateArena.Reset();
+			TransformUpdateArena.Reserve(cacheCount * sizeof(Transform::ComponentCache));
+			Vector<Transform::ComponentCache, true, ArenaAllocator> caches{ cacheCount, ArenaAllocator{ &TransformUpdateArena } };
+			uint64 offset{ TransformCache.CopyTo(caches.data()) };
+			for (uint32 i = 0; i < chunkCount; i++)
+			{
+				offset += ChunkTransformCaches[i].CopyTo(caches.data() + offset);
+			}
+			assert(offset == cacheCount);
+			Transform::Update(caches.data(), (uint32)cacheCount);
+		}
+
+		// ̃t[̕A[i؂o
+		TransformCache.Reset();
+		for (uint32 i = 0; i < chunkCount; i++)
+		{
+			ChunkTransformCaches[i].Reset();
 		}
 	}
 
@@ -212,7 +489,10 @@ namespace Rizityo::Script
 	EntityScript* Script::Component::GetEntityScript(ScriptID id)
 	{
 		const ID::IDType index{ ID::GetIndex(id) };
-		return EntityScripts[ID_Mapping[index]].get();
+		if (IsPoolIndex(PoolIndices[index]))
+			return PoolRegister().Pools[PoolIndices[index]]->Get(ID_Mapping[index]);
+
+		return GetEntityScripts(PoolIndices[index])[ID_Mapping[index]].get();
 	}
 
 } // Script
@@ -9,7 +9,11 @@ namespace Rizityo::Script
 	};
 
 	Script::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity);
+	// XNvg̃R|[lgcount܂Ƃ߂č
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count, OUT Script::Component* const components);
 	void RemoveComponent(Script::Component component);
+	// count̃R|[lgID̔z̊mۂȂŒǉł悤ɂ
+	void Reserve(uint32 count);
 	void Update(float dt);
 
 }
\ No newline at end of file
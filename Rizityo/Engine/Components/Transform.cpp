@@ -1,4 +1,7 @@
 #include "Transform.h"
+#include "../Core/Utility/Math/SIMD.h"
+#include "../Core/Utility/Thread/JobSystem.h"
+#include <algorithm>
 
 namespace Rizityo::Transform
 {
@@ -15,8 +18,43 @@ namespace Rizityo::Transform
 		Vector<uint8> ChangesFromPreviousFrame;
 		uint8 ReadWriteFlag;
 
+		Vector<uint32> DirtyIndices; // HasTransform0ɂTransformindex(d邱Ƃ)
+		Vector<uint32> AffectedIndices; // svZTransformindex(eɂȂ悤ɕׂ)
+
+		// Kw
+		// SĂTransform[D揇ɕׂĂA؂DepthFirstOrder̘A͈͂ɂȂ悤ɂ
+		// בւ̂index̔z񂾂ŁAPositionsToWorldȂǂ̔z񎩑̂index(=R|[lgID)̂܂
+		// (IDŒڈ悤ɕבւȂɁAšvZƐe̍s|鏈indexĔєтɓǂݏ)
+		Vector<uint32> Parents; // eindex(ȂUINT32_INVALID_NUM)
+		Vector<uint32> SubtreeSizes; // ܂ޕ؂̗vf
+		Vector<uint32> DepthFirstOrder; // [D揇ɕׂindex
+		Vector<uint32> OrderPositions; // index -> DepthFirstOrder̈ʒu
+		uint32 ParentedCount = 0; // êTransform̐(0ȂKw̏Ȃ)
+
+		// `̕
+		// ŒXebv̒ōŏɏ܂O̒lۑĂA`ł݂͌̒lƂ̊ԂԂ
+		Vector<Math::DX_Vector3> PreviousPositions;
+		Vector<Math::DX_Vector4> PreviousRotations;
+		Vector<Math::DX_Vector3> PreviousScales;
+		Vector<uint8> Interpolating; // ̃XebvőO̒lۑǂ
+		Vector<uint32> InterpolatingIndices;
+		float32 InterpolationAlpha = 1.f;
+
+		// švZɎgl(ԂȂ݂̂͌̒lƓ)
+		Vector<Math::DX_Vector3> RenderPositions;
+		Vector<Math::DX_Vector4> RenderRotations;
+		Vector<Math::DX_Vector3> RenderScales;
+
 	} // ϐ
 
+	namespace
+	{
+		// s܂Ƃ߂ČvZP(AVX28vẐ8̔{ɂ)
+		constexpr uint32 MatrixChunkSize = 256;
+		static_assert(MatrixChunkSize % 8 == 0);
+
+	} // 萔
+
 	namespace
 	{
 		Math::DX_Vector3 CalculateOrientation(Math::DX_Vector4 rotation)
@@ -29,41 +67,307 @@ namespace Rizityo::Transform
 			return orientation;
 		}
 
+		// ]EsړEXP[Ȃ̂ŁAts͈ʂ̋tsg킸ɉ]̓]uƃXP[̋t狁߂
+		// ts͖@̕ϊɎĝŕsړ
 		void CalculateTransformMatrices(ID::IDType index)
 		{
-			assert(index < Rotations.size());
-			assert(index < Positions.size());
-			assert(index < Scales.size());
+			assert(index < RenderRotations.size());
+			assert(index < RenderPositions.size());
+			assert(index < RenderScales.size());
+
+			const Math::DX_Vector4& q{ RenderRotations[index] };
+			const Math::DX_Vector3& t{ RenderPositions[index] };
+			const Math::DX_Vector3& s{ RenderScales[index] };
+
+			// PʃNH[^jI]s߂(sxNgE|`)
+			const float32 xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+			const float32 xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+			const float32 wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+			const float32 r00 = 1.f - 2.f * (yy + zz), r01 = 2.f * (xy + wz), r02 = 2.f * (xz - wy);
+			const float32 r10 = 2.f * (xy - wz), r11 = 1.f - 2.f * (xx + zz), r12 = 2.f * (yz + wx);
+			const float32 r20 = 2.f * (xz + wy), r21 = 2.f * (yz - wx), r22 = 1.f - 2.f * (xx + yy);
+
+			// world = S * R * T
+			ToWorld[index] = Math::DX_Matrix4x4{
+				r00 * s.x, r01 * s.x, r02 * s.x, 0.f,
+				r10 * s.y, r11 * s.y, r12 * s.y, 0.f,
+				r20 * s.z, r21 * s.z, r22 * s.z, 0.f,
+				t.x, t.y, t.z, 1.f };
+
+			// (S * R)^-1 = R^T * S^-1
+			const float32 invX = 1.f / s.x, invY = 1.f / s.y, invZ = 1.f / s.z;
+			InvWorld[index] = Math::DX_Matrix4x4{
+				r00 * invX, r10 * invY, r20 * invZ, 0.f,
+				r01 * invX, r11 * invY, r21 * invZ, 0.f,
+				r02 * invX, r12 * invY, r22 * invZ, 0.f,
+				0.f, 0.f, 0.f, 1.f };
+
+			HasTransform[index] = 1;
+		}
+
+#if USE_AVX2
+		// indices8Transform̍s܂Ƃ߂ČvZ(vZCalculateTransformMatricesƓ)
+		AVX2_FUNCTION void CalculateTransformMatricesAVX2(const uint32* const indices)
+		{
+			const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+			const __m256i index3 = _mm256_add_epi32(_mm256_slli_epi32(index, 1), index);
+			const __m256i index4 = _mm256_slli_epi32(index, 2);
+
+			// AoS̔z񂩂8𐬕ƂɏW߂
+			const float32* const rotation = &RenderRotations[0].x;
+			const float32* const scale = &RenderScales[0].x;
+			const __m256 qx = _mm256_i32gather_ps(rotation + 0, index4, 4);
+			const __m256 qy = _mm256_i32gather_ps(rotation + 1, index4, 4);
+			const __m256 qz = _mm256_i32gather_ps(rotation + 2, index4, 4);
+			const __m256 qw = _mm256_i32gather_ps(rotation + 3, index4, 4);
+			const __m256 sx = _mm256_i32gather_ps(scale + 0, index3, 4);
+			const __m256 sy = _mm256_i32gather_ps(scale + 1, index3, 4);
+			const __m256 sz = _mm256_i32gather_ps(scale + 2, index3, 4);
+
+			const __m256 one = _mm256_set1_ps(1.f);
+			const __m256 two = _mm256_set1_ps(2.f);
+			const __m256 xx = _mm256_mul_ps(qx, qx), yy = _mm256_mul_ps(qy, qy), zz = _mm256_mul_ps(qz, qz);
+			const __m256 xy = _mm256_mul_ps(qx, qy), xz = _mm256_mul_ps(qx, qz), yz = _mm256_mul_ps(qy, qz);
+			const __m256 wx = _mm256_mul_ps(qw, qx), wy = _mm256_mul_ps(qw, qy), wz = _mm256_mul_ps(qw, qz);
+			const __m256 r[3][3]{
+				{ _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), _mm256_mul_ps(two, _mm256_add_ps(xy, wz)), _mm256_mul_ps(two, _mm256_sub_ps(xz, wy)) },
+				{ _mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), _mm256_mul_ps(two, _mm256_add_ps(yz, wx)) },
+				{ _mm256_mul_ps(two, _mm256_add_ps(xz, wy)), _mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))) } };
+			const __m256 s[3]{ sx, sy, sz };
+			const __m256 inv[3]{ _mm256_div_ps(one, sx), _mm256_div_ps(one, sy), _mm256_div_ps(one, sz) };
+
+			// ƂɌvZʂTransformƂ̍sɕג
+			alignas(32) float32 world[3][3][8];
+			alignas(32) float32 inverseWorld[3][3][8];
+			for (uint32 row = 0; row < 3; row++)
+			{
+				for (uint32 column = 0; column < 3; column++)
+				{
+					_mm256_store_ps(world[row][column], _mm256_mul_ps(r[row][column], s[row]));
+					_mm256_store_ps(inverseWorld[row][column], _mm256_mul_ps(r[column][row], inv[column]));
+				}
+			}
+
+			for (uint32 i = 0; i < 8; i++)
+			{
+				const uint32 idx = indices[i];
+				const Math::DX_Vector3& t{ RenderPositions[idx] };
+				ToWorld[idx] = Math::DX_Matrix4x4{
+					world[0][0][i], world[0][1][i], world[0][2][i], 0.f,
+					world[1][0][i], world[1][1][i], world[1][2][i], 0.f,
+					world[2][0][i], world[2][1][i], world[2][2][i], 0.f,
+					t.x, t.y, t.z, 1.f };
+				InvWorld[idx] = Math::DX_Matrix4x4{
+					inverseWorld[0][0][i], inverseWorld[0][1][i], inverseWorld[0][2][i], 0.f,
+					inverseWorld[1][0][i], inverseWorld[1][1][i], inverseWorld[1][2][i], 0.f,
+					inverseWorld[2][0][i], inverseWorld[2][1][i], inverseWorld[2][2][i], 0.f,
+					0.f, 0.f, 0.f, 1.f };
+				HasTransform[idx] = 1;
+			}
+		}
+#endif // USE_AVX2
+
+#if USE_AVX2
+		// [first, first + 8)̌܂Ƃ߂ČvZ(vZCalculateOrientations̃XJ[łƓ)
+		AVX2_FUNCTION void CalculateOrientationsAVX2(uint32 first)
+		{
+			const __m256i offset = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+			const float32* const rotation = &Rotations[first].x;
+			const __m256 qx = _mm256_i32gather_ps(rotation + 0, offset, 4);
+			const __m256 qy = _mm256_i32gather_ps(rotation + 1, offset, 4);
+			const __m256 qz = _mm256_i32gather_ps(rotation + 2, offset, 4);
+			const __m256 qw = _mm256_i32gather_ps(rotation + 3, offset, 4);
+
+			const __m256 one = _mm256_set1_ps(1.f);
+			const __m256 two = _mm256_set1_ps(2.f);
+			alignas(32) float32 x[8];
+			alignas(32) float32 y[8];
+			alignas(32) float32 z[8];
+			_mm256_store_ps(x, _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(qx, qz), _mm256_mul_ps(qw, qy))));
+			_mm256_store_ps(y, _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qy, qz), _mm256_mul_ps(qw, qx))));
+			_mm256_store_ps(z, _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(qx, qx), _mm256_mul_ps(qy, qy)))));
+
+			for (uint32 i = 0; i < 8; i++)
+			{
+				Orientations[first + i] = Math::DX_Vector3{ x[i], y[i], z[i] };
+			}
+		}
+#endif // USE_AVX2
+
+		// [begin, end)̌܂Ƃ߂ČvZ
+		// (0, 0, 1)]͉̂]s3sڂȂ̂ŁANH[^jI璼ڋ߂
+		void CalculateOrientations(uint32 begin, uint32 end)
+		{
+			uint32 i = begin;
+#if USE_AVX2
+			if (Math::SIMD::IsAVX2Supported())
+			{
+				for (; i + 8 <= end; i += 8)
+				{
+					CalculateOrientationsAVX2(i);
+				}
+			}
+#endif // USE_AVX2
+			for (; i < end; i++)
+			{
+				const Math::DX_Vector4& q{ Rotations[i] };
+				Orientations[i] = Math::DX_Vector3{
+					2.f * (q.x * q.z + q.w * q.y),
+					2.f * (q.y * q.z - q.w * q.x),
+					1.f - 2.f * (q.x * q.x + q.y * q.y) };
+			}
+		}
+
+		// švZɎgl߂
+		void CalculateRenderValues(ID::IDType index)
+		{
+			if (!Interpolating[index] || InterpolationAlpha >= 1.f)
+			{
+				RenderPositions[index] = Positions[index];
+				RenderRotations[index] = Rotations[index];
+				RenderScales[index] = Scales[index];
+				return;
+			}
 
 			using namespace DirectX;
-			XMVECTOR r{ XMLoadFloat4(&Rotations[index]) };
-			XMVECTOR t{ XMLoadFloat3(&Positions[index]) };
-			XMVECTOR s{ XMLoadFloat3(&Scales[index]) };
+			const XMVECTOR alpha{ XMVectorReplicate(InterpolationAlpha) };
+			XMStoreFloat3(&RenderPositions[index], XMVectorLerpV(XMLoadFloat3(&PreviousPositions[index]), XMLoadFloat3(&Positions[index]), alpha));
+			XMStoreFloat3(&RenderScales[index], XMVectorLerpV(XMLoadFloat3(&PreviousScales[index]), XMLoadFloat3(&Scales[index]), alpha));
+			XMStoreFloat4(&RenderRotations[index], XMQuaternionSlerpV(XMLoadFloat4(&PreviousRotations[index]), XMLoadFloat4(&Rotations[index]), alpha));
+		}
 
-			XMMATRIX world{ XMMatrixAffineTransformation(s, XMQuaternionIdentity(), r, t) };
-			XMStoreFloat4x4(&ToWorld[index], world);
+		// ̃Xebvōŏ݂̏łΏޑO̒lۑ
+		void SavePreviousValues(ID::IDType index)
+		{
+			if (!Interpolating[index])
+			{
+				Interpolating[index] = 1;
+				PreviousPositions[index] = Positions[index];
+				PreviousRotations[index] = Rotations[index];
+				PreviousScales[index] = Scales[index];
+				InterpolatingIndices.emplace_back(index);
+			}
+		}
 
-			world.r[3] = XMVectorSet(0.f, 0.f, 0.f, 1.f);
-			XMMATRIX inverseWorld{ XMMatrixInverse(nullptr, world) };
-			XMStoreFloat4x4(&InvWorld[index], inverseWorld);
+		// HasTransform0ɂUpdateTransformMatricesŌvZ悤ɓo^
+		void MarkDirty(ID::IDType index)
+		{
+			if (HasTransform[index])
+			{
+				HasTransform[index] = 0;
+				DirtyIndices.emplace_back(index);
+			}
+		}
 
-			HasTransform[index] = 1;
+		// DepthFirstOrder[begin, begin + size)dsẗʒuɈڂ(dst͔͈͂̊O)
+		void MoveSubtree(uint32 begin, uint32 size, uint32 dst)
+		{
+			uint32* const order = DepthFirstOrder.data();
+			uint32 first, last;
+			if (dst > begin)
+			{
+				assert(dst >= begin + size);
+				std::rotate(order + begin, order + begin + size, order + dst);
+				first = begin;
+				last = dst;
+			}
+			else
+			{
+				std::rotate(order + dst, order + begin, order + begin + size);
+				first = dst;
+				last = begin + size;
+			}
+
+			for (uint32 i = first; i < last; i++)
+			{
+				OrderPositions[order[i]] = i;
+			}
+		}
+
+		// ؂UɈڂĐeOAVe̕؂̖ɕt
+		// בւ͊Ԃɂvf̐ɔႷ̂ŁAt[eς悤Ȏg͑z肵Ȃ
+		void SetParentIndex(uint32 index, uint32 parent)
+		{
+			assert(index < Parents.size());
+			const uint32 size = SubtreeSizes[index];
+			const uint32 count = (uint32)DepthFirstOrder.size();
+
+			if (Parents[index] != UINT32_INVALID_NUM)
+			{
+				for (uint32 ancestor = Parents[index]; ancestor != UINT32_INVALID_NUM; ancestor = Parents[ancestor])
+				{
+					assert(SubtreeSizes[ancestor] > size);
+					SubtreeSizes[ancestor] -= size;
+				}
+
+				const uint32 begin = OrderPositions[index];
+				if (begin + size != count)
+				{
+					MoveSubtree(begin, size, count);
+				}
+				Parents[index] = UINT32_INVALID_NUM;
+				ParentedCount--;
+			}
+
+			if (parent != UINT32_INVALID_NUM)
+			{
+				assert(parent < Parents.size());
+				const uint32 begin = OrderPositions[index];
+				// ̎q͐eɂłȂ
+				assert(OrderPositions[parent] < begin || OrderPositions[parent] >= begin + size);
+
+				const uint32 dst = OrderPositions[parent] + SubtreeSizes[parent];
+				if (dst != begin)
+				{
+					MoveSubtree(begin, size, dst);
+				}
+				for (uint32 ancestor = parent; ancestor != UINT32_INVALID_NUM; ancestor = Parents[ancestor])
+				{
+					SubtreeSizes[ancestor] += size;
+				}
+				Parents[index] = parent;
+				ParentedCount++;
+			}
+
+			// eςƑΒl̈Ӗς̂ŕԂȂ
+			if (Interpolating[index])
+			{
+				PreviousPositions[index] = Positions[index];
+				PreviousRotations[index] = Rotations[index];
+				PreviousScales[index] = Scales[index];
+			}
+
+			// ؑŜ̃[hs񂪕ς
+			MarkDirty(index);
+			ChangesFromPreviousFrame[index] |= ComponentFlags::All;
+		}
+
+		// Õt[̕ύXtOǂ܂Ă΁Ãt[̍ŏ݂̏̑Oɏ
+		void ResetChangesIfRead()
+		{
+			if (ReadWriteFlag)
+			{
+				memset(ChangesFromPreviousFrame.data(), 0, ChangesFromPreviousFrame.size());
+				ReadWriteFlag = 0;
+			}
 		}
 
 		void SetPosition(TransformID id, const Math::DX_Vector3& position)
 		{
 			const uint32 index = ID::GetIndex(id);
+			SavePreviousValues(index);
 			Positions[index] = position;
-			HasTransform[index] = 0;
+			MarkDirty(index);
 			ChangesFromPreviousFrame[index] |= ComponentFlags::Position;
 		}
 
 		void SetRotation(TransformID id, const Math::DX_Vector4& rotation_quaternion)
 		{
 			const uint32 index = ID::GetIndex(id);
+			SavePreviousValues(index);
 			Rotations[index] = rotation_quaternion;
 			Orientations[index] = CalculateOrientation(rotation_quaternion);
-			HasTransform[index] = 0;
+			MarkDirty(index);
 			ChangesFromPreviousFrame[index] |= ComponentFlags::Rotation;
 		}
 
@@ -74,8 +378,9 @@ namespace Rizityo::Transform
 		void SetScale(TransformID id, const Math::DX_Vector3& scale)
 		{
 			const uint32 index = ID::GetIndex(id);
+			SavePreviousValues(index);
 			Scales[index] = scale;
-			HasTransform[index] = 0;
+			MarkDirty(index);
 			ChangesFromPreviousFrame[index] |= ComponentFlags::Scale;
 		}
 
@@ -92,7 +397,14 @@ namespace Rizityo::Transform
 			Rotations[index] = rotation;
 			Orientations[index] = CalculateOrientation(rotation);
 			Scales[index] = Math::DX_Vector3{ info.Scale };
-			HasTransform[index] = 0;
+			if (Interpolating[index])
+			{
+				// ÕGeBeB̒lԂȂ悤ɂ
+				PreviousPositions[index] = Positions[index];
+				PreviousRotations[index] = rotation;
+				PreviousScales[index] = Scales[index];
+			}
+			MarkDirty(index);
 			ChangesFromPreviousFrame[index] = (uint8)ComponentFlags::All;
 		}
 		else
@@ -105,31 +417,318 @@ namespace Rizityo::Transform
 			ToWorld.emplace_back();
 			InvWorld.emplace_back();
 			HasTransform.emplace_back((uint8)0);
+			DirtyIndices.emplace_back(index);
 			ChangesFromPreviousFrame.emplace_back((uint8)ComponentFlags::All);
+			Parents.emplace_back(UINT32_INVALID_NUM);
+			SubtreeSizes.emplace_back(1u);
+			OrderPositions.emplace_back((uint32)DepthFirstOrder.size());
+			DepthFirstOrder.emplace_back(index);
+			PreviousPositions.emplace_back();
+			PreviousRotations.emplace_back();
+			PreviousScales.emplace_back();
+			Interpolating.emplace_back((uint8)0);
+			RenderPositions.emplace_back();
+			RenderRotations.emplace_back();
+			RenderScales.emplace_back();
 		}
+		assert(Parents[index] == UINT32_INVALID_NUM && SubtreeSizes[index] == 1);
 
 		return Component{ TransformID{entity.ID()} };
 	}
 
-	void RemoveComponent([[maybe_unused]] Transform::Component component)
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count,
+		const Math::Vector3* const positions, const Math::Quaternion* const rotations, OUT Transform::Component* const components)
+	{
+		assert(entities && components);
+
+		// g܂킷index1㏑AVindex͖ɂ܂Ƃ߂Ēǉ
+		const uint32 first{ (uint32)Positions.size() };
+		uint32 appendCount = 0;
+		InitInfo elementInfo{ info };
+		for (uint32 i = 0; i < count; i++)
+		{
+			assert(entities[i].IsValid());
+			components[i] = Component{ TransformID{ entities[i].ID() } };
+			if (ID::GetIndex(entities[i].ID()) >= first)
+			{
+				appendCount++;
+				continue;
+			}
+
+			if (positions)
+			{
+				elementInfo.Position[0] = positions[i].x;
+				elementInfo.Position[1] = positions[i].y;
+				elementInfo.Position[2] = positions[i].z;
+			}
+			if (rotations)
+			{
+				elementInfo.Rotation[0] = rotations[i].x;
+				elementInfo.Rotation[1] = rotations[i].y;
+				elementInfo.Rotation[2] = rotations[i].z;
+				elementInfo.Rotation[3] = rotations[i].w;
+			}
+			components[i] = CreateComponent(elementInfo, entities[i]);
+		}
+
+		if (!appendCount)
+			return;
+
+		// Vindex[first, size)ɌԂȂł邱
+		const uint32 size{ first + appendCount };
+		Reserve(appendCount);
+		Positions.resize(size, Math::DX_Vector3{ info.Position });
+		Rotations.resize(size, Math::DX_Vector4{ info.Rotation });
+		Orientations.resize(size);
+		Scales.resize(size, Math::DX_Vector3{ info.Scale });
+		ToWorld.resize(size);
+		InvWorld.resize(size);
+		HasTransform.resize(size, (uint8)0);
+		ChangesFromPreviousFrame.resize(size, (uint8)ComponentFlags::All);
+		Parents.resize(size, UINT32_INVALID_NUM);
+		SubtreeSizes.resize(size, 1u);
+		PreviousPositions.resize(size);
+		PreviousRotations.resize(size);
+		PreviousScales.resize(size);
+		Interpolating.resize(size, (uint8)0);
+		RenderPositions.resize(size);
+		RenderRotations.resize(size);
+		RenderScales.resize(size);
+
+		OrderPositions.resize(size);
+		for (uint32 index = first; index < size; index++)
+		{
+			OrderPositions[index] = (uint32)DepthFirstOrder.size();
+			DepthFirstOrder.emplace_back(index);
+			DirtyIndices.emplace_back(index);
+		}
+
+		if (positions || rotations)
+		{
+			for (uint32 i = 0; i < count; i++)
+			{
+				const ID::IDType index{ ID::GetIndex(entities[i].ID()) };
+				if (index < first)
+					continue;
+
+				assert(index < size);
+				if (positions)
+				{
+					Positions[index] = Math::DX_Vector3{ positions[i].x, positions[i].y, positions[i].z };
+				}
+				if (rotations)
+				{
+					Rotations[index] = Math::DX_Vector4{ rotations[i].x, rotations[i].y, rotations[i].z, rotations[i].w };
+				}
+			}
+		}
+
+		CalculateOrientations(first, size);
+	}
+
+	void RemoveComponent(Transform::Component component)
 	{
 		assert(component.IsValid());
+		const ID::IDType index{ ID::GetIndex(component.ID()) };
+
+		// q͐eOĎc(Βl̂܂܃[hł̒lɂȂ)
+		while (SubtreeSizes[index] > 1)
+		{
+			SetParentIndex(DepthFirstOrder[OrderPositions[index] + 1], UINT32_INVALID_NUM);
+		}
+
+		if (Parents[index] != UINT32_INVALID_NUM)
+		{
+			SetParentIndex(index, UINT32_INVALID_NUM);
+		}
+	}
+
+	void Reserve(uint32 count)
+	{
+		const uint64 capacity{ Positions.size() + count };
+		Positions.reserve(capacity);
+		Rotations.reserve(capacity);
+		Orientations.reserve(capacity);
+		Scales.reserve(capacity);
+		ToWorld.reserve(capacity);
+		InvWorld.reserve(capacity);
+		HasTransform.reserve(capacity);
+		ChangesFromPreviousFrame.reserve(capacity);
+		Parents.reserve(capacity);
+		SubtreeSizes.reserve(capacity);
+		OrderPositions.reserve(capacity);
+		DepthFirstOrder.reserve(capacity);
+		PreviousPositions.reserve(capacity);
+		PreviousRotations.reserve(capacity);
+		PreviousScales.reserve(capacity);
+		Interpolating.reserve(capacity);
+		RenderPositions.reserve(capacity);
+		RenderRotations.reserve(capacity);
+		RenderScales.reserve(capacity);
+		DirtyIndices.reserve(DirtyIndices.size() + count);
 	}
 
 	void GetTransformMatrices(const GameEntity::EntityID id, OUT Math::DX_Matrix4x4& world, OUT Math::DX_Matrix4x4& inverseWorld)
 	{
 		assert(GameEntity::Entity{ id }.IsValid());
 
+		// ʏUpdateTransformMatricesŌvZς
+		// eύXĂꍇ̂ŁAvẐ̂΂܂Ƃ߂ČvZ
 		const ID::IDType entityIndex{ ID::GetIndex(id) };
-		if (!HasTransform[entityIndex])
+		if (DirtyIndices.size())
 		{
-			CalculateTransformMatrices(entityIndex);
+			UpdateTransformMatrices();
 		}
+		assert(HasTransform[entityIndex]);
 
 		world = ToWorld[entityIndex];
 		inverseWorld = InvWorld[entityIndex];
 	}
 
+	void GetAllTransformMatrices(OUT Vector<Math::DX_Matrix4x4>& world, OUT Vector<Math::DX_Matrix4x4>& inverseWorld)
+	{
+		if (DirtyIndices.size())
+		{
+			UpdateTransformMatrices();
+		}
+
+		const uint64 count{ ToWorld.size() };
+		world.resize(count);
+		inverseWorld.resize(count);
+		if (count)
+		{
+			memcpy(world.data(), ToWorld.data(), count * sizeof(Math::DX_Matrix4x4));
+			memcpy(inverseWorld.data(), InvWorld.data(), count * sizeof(Math::DX_Matrix4x4));
+		}
+	}
+
+	void UpdateTransformMatrices()
+	{
+		// dƁAGetTransformMatricesŊɌvZꂽ̂
+		// (HasTransform1ɂĂƂœindex2vZȂ悤ɂ)
+		uint32 dirtyCount = 0;
+		for (const uint32 index : DirtyIndices)
+		{
+			if (!HasTransform[index])
+			{
+				HasTransform[index] = 1;
+				DirtyIndices[dirtyCount++] = index;
+			}
+		}
+
+		// Kwꍇ͕ύX̂Transform̕؂[D揇ɏW߂
+		// ؂DepthFirstOrder̘A͈͂Ȃ̂ŁAύX̂Ǝq̐ɔႵԂōς
+		const Vector<uint32>& affected{ ParentedCount ? AffectedIndices : DirtyIndices };
+		uint32 count = dirtyCount;
+		if (ParentedCount)
+		{
+			std::sort(DirtyIndices.begin(), DirtyIndices.begin() + dirtyCount, [](uint32 a, uint32 b)
+			{
+				return OrderPositions[a] < OrderPositions[b];
+			});
+
+			AffectedIndices.clear();
+			uint32 coveredEnd = 0; // Oɒǉ؂̏I(O͑c̕؂Ɋ܂܂Ă)
+			for (uint32 i = 0; i < dirtyCount; i++)
+			{
+				const uint32 begin = OrderPositions[DirtyIndices[i]];
+				if (begin < coveredEnd)
+					continue;
+
+				coveredEnd = begin + SubtreeSizes[DirtyIndices[i]];
+				for (uint32 position = begin; position < coveredEnd; position++)
+				{
+					const uint32 index = DepthFirstOrder[position];
+					HasTransform[index] = 1;
+					AffectedIndices.emplace_back(index);
+				}
+			}
+			count = (uint32)AffectedIndices.size();
+		}
+
+		if (count)
+		{
+			[[maybe_unused]] const bool avx2 = Math::SIMD::IsAVX2Supported();
+			// ܂ȇΒlōs߂(êȂ̂͂̂܂܃[hsɂȂ)
+			auto calculate = [avx2, &affected](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; i++)
+				{
+					CalculateRenderValues(affected[i]);
+				}
+
+				uint32 i = begin;
+#if USE_AVX2
+				if (avx2)
+				{
+					for (; i + 8 <= end; i += 8)
+					{
+						CalculateTransformMatricesAVX2(&affected[i]);
+					}
+				}
+#endif // USE_AVX2
+				for (; i < end; i++)
+				{
+					CalculateTransformMatrices(affected[i]);
+				}
+			};
+
+			Thread::JobSystem::ParallelFor(count, MatrixChunkSize, calculate);
+
+			// eɕł̂ŁAO珇ɐẽ[hs|΂悢
+			if (ParentedCount)
+			{
+				using namespace DirectX;
+				for (uint32 i = 0; i < count; i++)
+				{
+					const uint32 index = affected[i];
+					const uint32 parent = Parents[index];
+					if (parent == UINT32_INVALID_NUM)
+						continue;
+
+					// world = local * parentWorld, (local * parent)^-1 = parent^-1 * local^-1
+					XMMATRIX world{ XMMatrixMultiply(XMLoadFloat4x4(&ToWorld[index]), XMLoadFloat4x4(&ToWorld[parent])) };
+					XMMATRIX inverseWorld{ XMMatrixMultiply(XMLoadFloat4x4(&InvWorld[parent]), XMLoadFloat4x4(&InvWorld[index])) };
+					XMStoreFloat4x4(&ToWorld[index], world);
+					XMStoreFloat4x4(&InvWorld[index], inverseWorld);
+				}
+			}
+		}
+
+		DirtyIndices.clear();
+	}
+
+	void BeginFixedStep()
+	{
+		// ÕXebvŕԂĂ݂̂͌̒lŌvZ
+		for (const uint32 index : InterpolatingIndices)
+		{
+			Interpolating[index] = 0;
+			MarkDirty(index);
+		}
+		InterpolatingIndices.clear();
+	}
+
+	void SetInterpolationAlpha(float32 alpha)
+	{
+		assert(alpha >= 0.f && alpha <= 1.f);
+		InterpolationAlpha = alpha;
+		for (const uint32 index : InterpolatingIndices)
+		{
+			MarkDirty(index);
+		}
+	}
+
+	void SetParent(GameEntity::EntityID child, GameEntity::EntityID parent)
+	{
+		assert(GameEntity::Entity{ child }.IsValid());
+		assert(!ID::IsValid(parent) || GameEntity::Entity{ parent }.IsValid());
+		const uint32 parentIndex{ ID::IsValid(parent) ? ID::GetIndex(parent) : UINT32_INVALID_NUM };
+		assert(parentIndex != ID::GetIndex(child));
+		ResetChangesIfRead();
+		SetParentIndex(ID::GetIndex(child), parentIndex);
+	}
+
 	void GetUpdatedComponentsFlags(const GameEntity::EntityID* const ids, uint32 count, OUT uint8* const flags)
 	{
 		assert(ids && count && flags);
@@ -145,12 +744,7 @@ namespace Rizityo::Transform
 	void Update(const ComponentCache* const cache, uint32 count)
 	{
 		assert(cache && count);
-
-		if (ReadWriteFlag)
-		{
-			memset(ChangesFromPreviousFrame.data(), 0, ChangesFromPreviousFrame.size());
-			ReadWriteFlag = 0;
-		}
+		ResetChangesIfRead();
 
 		for (uint32 i = 0; i < count; i++)
 		{
@@ -179,6 +773,55 @@ namespace Rizityo::Transform
 		}
 	}
 
+	void SetPositions(const GameEntity::EntityID* const ids, const Math::Vector3* const positions, uint32 count)
+	{
+		assert(ids && positions && count);
+		ResetChangesIfRead();
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			assert(GameEntity::Entity{ ids[i] }.IsValid());
+			const ID::IDType index{ ID::GetIndex(ids[i]) };
+			assert(index < Positions.size());
+			SavePreviousValues(index);
+			Positions[index] = Math::DX_Vector3{ positions[i].x, positions[i].y, positions[i].z };
+			MarkDirty(index);
+			ChangesFromPreviousFrame[index] |= ComponentFlags::Position;
+		}
+	}
+
+	void GetPositions(const GameEntity::EntityID* const ids, uint32 count, OUT Math::Vector3* const positions)
+	{
+		assert(ids && positions);
+		for (uint32 i = 0; i < count; i++)
+		{
+			assert(GameEntity::Entity{ ids[i] }.IsValid());
+			const ID::IDType index{ ID::GetIndex(ids[i]) };
+			assert(index < Positions.size());
+			const Math::DX_Vector3& position{ Positions[index] };
+			positions[i] = Math::Vector3{ position.x, position.y, position.z };
+		}
+	}
+
+	void SetRotations(const GameEntity::EntityID* const ids, const Math::Quaternion* const rotations, uint32 count)
+	{
+		assert(ids && rotations && count);
+		ResetChangesIfRead();
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			assert(GameEntity::Entity{ ids[i] }.IsValid());
+			const ID::IDType index{ ID::GetIndex(ids[i]) };
+			assert(index < Rotations.size());
+			const Math::DX_Vector4 rotation{ rotations[i].x, rotations[i].y, rotations[i].z, rotations[i].w };
+			SavePreviousValues(index);
+			Rotations[index] = rotation;
+			Orientations[index] = CalculateOrientation(rotation);
+			MarkDirty(index);
+			ChangesFromPreviousFrame[index] |= ComponentFlags::Rotation;
+		}
+	}
+
 	Math::Vector3 Component::GetPosition() const
 	{
 		assert(IsValid());
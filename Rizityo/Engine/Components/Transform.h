@@ -31,9 +31,38 @@ namespace Rizityo::Transform
     };
 
 	Transform::Component CreateComponent(const InitInfo& info, GameEntity::Entity entity);
+	// infocount̃R|[lg܂Ƃ߂č(positionsErotationsinfo̒l̑Ɏg)
+	// VǉTransform͔z܂Ƃ߂ĐL΂ASIMDł܂Ƃ߂ČvZ
+	void CreateComponents(const InitInfo& info, const GameEntity::Entity* const entities, uint32 count,
+		const Math::Vector3* const positions, const Math::Quaternion* const rotations, OUT Transform::Component* const components);
 	void RemoveComponent(Transform::Component component);
+	// countTransform̊mۂȂŒǉł悤ɂ
+	void Reserve(uint32 count);
 	void GetTransformMatrices(const GameEntity::EntityID id, OUT Math::DX_Matrix4x4& world, OUT Math::DX_Matrix4x4& inverseWorld);
+	// SĂTransform̍sGeBeBindexɃRs[(`Xbhɓnt[pPbgp)
+	void GetAllTransformMatrices(OUT Vector<Math::DX_Matrix4x4>& world, OUT Vector<Math::DX_Matrix4x4>& inverseWorld);
+
+	// childparent̎qɂ(parentID̏ꍇ͐eO)
+	// eꍇAʒuE]EXP[͐ȇΒlɂȂ
+	void SetParent(GameEntity::EntityID child, GameEntity::EntityID parent);
+
+	// ύX̂Transform̃[hsƋts܂Ƃ߂ČvZ(`̑O1t[1Ă)
+	// WuVXeĂ΃`NƂɕɌvZ
+	void UpdateTransformMatrices();
+
+	// ŒXebv̕`̕
+	// ŒXebvn߂OɌĂԂƁÃXebvōŏɏ܂ꂽƂ̒lۑ
+	void BeginFixedStep();
+	// ۑlƌ݂̒l̊Ԃalpha(0~1)ŕԂčsvZ(UpdateTransformMatrices̑OɌĂ)
+	void SetInterpolationAlpha(float32 alpha);
 
     void GetUpdatedComponentsFlags(const GameEntity::EntityID* const ids, uint32 count, OUT uint8* const flags);
     void Update(const ComponentCache* const cache, uint32 count);
+
+    // ComponentCacheɕ̃GeBeB̈ʒuE]܂Ƃ߂ď
+    // t[SGeBeB𓮂V~[V
+    void SetPositions(const GameEntity::EntityID* const ids, const Math::Vector3* const positions, uint32 count);
+    // ̃GeBeB̈ʒu܂Ƃ߂ēǂ(EntityƂ̐mFComponentȂ)
+    void GetPositions(const GameEntity::EntityID* const ids, uint32 count, OUT Math::Vector3* const positions);
+    void SetRotations(const GameEntity::EntityID* const ids, const Math::Quaternion* const rotations, uint32 count);
 }
\ No newline at end of file
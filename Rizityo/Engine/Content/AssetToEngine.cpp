@@ -63,7 +63,7 @@ namespace Rizityo::Content
         };
 
         constexpr uintptr_t SingleMeshFlag{ (uintptr_t)0x01 }; // GeometryHierarchies̗vfɂ̃tOĂꍇGPU IDł邱Ƃ\
-        FreeList<uint8*> GeometryHierarchies;
+        PagedFreeList<uint8*> GeometryHierarchies; // `撆ɓǂ(폜͕`Xbh҂ɌĂׂ̂ŁAǂނƂbN)
         std::mutex GeometryMutex;
 
         // std::vectorp
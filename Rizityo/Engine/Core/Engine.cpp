@@ -1,16 +1,20 @@
 #if !defined(SHIPPING)
 
 #include "Content/ContentLoader.h"
+#include "Components/Entity.h"
 #include "Components/Script.h"
+#include "Components/Transform.h"
 #include "Core/Platform/PlatformWindow/PlatformWindow.h"
 #include "Graphics/Renderer.h"
-#include <thread>
+#include "Core/Utility/Thread/JobSystem.h"
+#include "Core/Utility/Time/FrameScheduler.h"
 
 using namespace Rizityo;
 
 namespace
 {
 	Graphics::RenderSurface GameWindow{};
+	Rizityo::Time::FrameScheduler Scheduler{};
 
 	LRESULT WinProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
 	{
@@ -40,6 +44,8 @@ namespace
 
 bool EngineInitialize()
 {
+	Rizityo::Thread::JobSystem::Initialize();
+
 	if (!Rizityo::Content::LoadGame())
 		return false;
 	
@@ -48,19 +54,30 @@ bool EngineInitialize()
 	if (!GameWindow.Window.IsValid())
 		return false;
 
+	Scheduler.Reset();
 	return true;
 }
 
 void EngineUpdate()
 {
-	Rizityo::Script::Update(10.f); // TODO: timerg
-	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	const uint32 stepCount = Scheduler.BeginFrame();
+	Rizityo::Thread::JobSystem::ExecuteMainThreadJobs();
+	for (uint32 i = 0; i < stepCount; i++)
+	{
+		Rizityo::Transform::BeginFixedStep();
+		Rizityo::Script::Update(Scheduler.FixedDeltaTime());
+		Rizityo::GameEntity::ApplyCommands();
+	}
+	Rizityo::Transform::SetInterpolationAlpha(Scheduler.InterpolationAlpha());
+	Rizityo::Transform::UpdateTransformMatrices();
+	Scheduler.WaitForNextFrame();
 }
 
 void EngineShutdown()
 {
 	Platform::RemoveMyWindow(GameWindow.Window.ID());
 	Rizityo::Content::UnLoadGame();
+	Rizityo::Thread::JobSystem::Shutdown();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,257 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <cstddef>
+
+// Rei(Vector, FreeList)ɓnAP[^[
+// AP[^[͈ȉȒľ^ŁAReiƈꏏɃRs[E[u
+//     void* Reallocate(void* data, uint64 oldSize, uint64 newSize, uint64 alignment) // datanullptrȂVmہBgoldSize܂ňp
+//     void Deallocate(void* data, uint64 size)
+// (LinearArena, FixedPool)AP[^[̓|C^̂ŁÂ̓Rei蒷Ă邱
+
+namespace Rizityo
+{
+	// Math.h̓Reiɓǂݍ܂̂łŗpӂ(alignment2ׂ̂)
+	[[nodiscard]] constexpr uint64 AlignAllocationUp(uint64 size, uint64 alignment)
+	{
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+
+	// reallocEfreeg(ReĩftHg)
+	struct MallocAllocator
+	{
+		[[nodiscard]] void* Reallocate(void* const data, [[maybe_unused]] uint64 oldSize, uint64 newSize, [[maybe_unused]] uint64 alignment)
+		{
+			assert(alignment <= alignof(std::max_align_t));
+			// realloc()͐V̈悪mۂꂽꍇɎŌ̃f[^Rs[
+			return realloc(data, newSize);
+		}
+
+		void Deallocate(void* const data, [[maybe_unused]] uint64 size)
+		{
+			free(data);
+		}
+	};
+
+	// 擪珇ɐ؂ṏ(t[Ƃ֐̒̈ꎞIȃp)
+	// ʂɂ͉AReset()Rewind()ł܂Ƃ߂Ė߂(Ōɐ؂ô͂̏ŐLяk݂ł)
+	// XbhZ[tł͂Ȃ
+	class LinearArena
+	{
+	public:
+		LinearArena() = default;
+
+		explicit LinearArena(uint64 capacity)
+		{
+			Reserve(capacity);
+		}
+
+		// Ăяõ(X^bN̔zȂ)gB͂Ȃ
+		LinearArena(void* const buffer, uint64 capacity) : _Buffer{ static_cast<uint8*>(buffer) }, _Capacity{ capacity }, _OwnsBuffer{ false }
+		{
+			assert(buffer && capacity);
+		}
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		~LinearArena()
+		{
+			if (_OwnsBuffer)
+			{
+				free(_Buffer);
+			}
+		}
+
+		// ̂ƂɁAȂƂcapacityoCg؂o悤ɂ(ĂΉȂ̂ŁAĂłmۂ͍ŏ)
+		void Reserve(uint64 capacity)
+		{
+			assert(!_Offset && _OwnsBuffer);
+			if (capacity > _Capacity)
+			{
+				free(_Buffer);
+				_Buffer = static_cast<uint8*>(malloc(capacity));
+				assert(_Buffer);
+				_Capacity = capacity;
+			}
+		}
+
+		[[nodiscard]] void* Allocate(uint64 size, uint64 alignment)
+		{
+			assert(alignment && (alignment & (alignment - 1)) == 0);
+			const uint64 address{ AlignAllocationUp((uint64)(uintptr_t)(_Buffer + _Offset), alignment) };
+			const uint64 offset{ address - (uint64)(uintptr_t)_Buffer };
+			assert(offset + size <= _Capacity && "LinearArena̗eʂ܂");
+			if (offset + size > _Capacity)
+				return nullptr;
+
+			_Last = offset;
+			_Offset = offset + size;
+			return _Buffer + offset;
+		}
+
+		[[nodiscard]] void* Reallocate(void* const data, uint64 oldSize, uint64 newSize, uint64 alignment)
+		{
+			if (!data)
+				return Allocate(newSize, alignment);
+
+			// Ōɐ؂ôȂ炻̏ŐL΂
+			if (IsLast(data, oldSize) && _Last + newSize <= _Capacity)
+			{
+				_Offset = _Last + newSize;
+				return data;
+			}
+
+			void* const newData{ Allocate(newSize, alignment) };
+			if (newData)
+			{
+				memcpy(newData, data, std::min(oldSize, newSize));
+			}
+			return newData;
+		}
+
+		// Ōɐ؂ô߂(ȊOReset()܂Ŏc)
+		void Deallocate(void* const data, uint64 size)
+		{
+			if (data && IsLast(data, size))
+			{
+				_Offset = _Last;
+			}
+		}
+
+		void Reset()
+		{
+			_Offset = 0;
+			_Last = 0;
+		}
+
+		// Mark()̎_܂Ŗ߂(ɐ؂ô͑SĖɂȂ)
+		[[nodiscard]] constexpr uint64 Mark() const { return _Offset; }
+		void Rewind(uint64 mark)
+		{
+			assert(mark <= _Offset);
+			_Offset = mark;
+			_Last = mark;
+		}
+
+		[[nodiscard]] constexpr uint64 Used() const { return _Offset; }
+		[[nodiscard]] constexpr uint64 Capacity() const { return _Capacity; }
+
+	private:
+		uint8* _Buffer = nullptr;
+		uint64 _Capacity = 0;
+		uint64 _Offset = 0; // ɐ؂oʒu
+		uint64 _Last = 0; // Ōɐ؂ô̈ʒu
+		bool _OwnsBuffer = true;
+
+		[[nodiscard]] bool IsLast(const void* const data, uint64 size) const
+		{
+			return data == _Buffer + _Last && _Last + size == _Offset;
+		}
+	};
+
+	struct ArenaAllocator
+	{
+		LinearArena* Arena = nullptr;
+
+		[[nodiscard]] void* Reallocate(void* const data, uint64 oldSize, uint64 newSize, uint64 alignment)
+		{
+			assert(Arena);
+			return Arena->Reallocate(data, oldSize, newSize, alignment);
+		}
+
+		void Deallocate(void* const data, uint64 size)
+		{
+			assert(Arena || !data);
+			if (Arena)
+			{
+				Arena->Deallocate(data, size);
+			}
+		}
+	};
+
+	// 傫̃ubNBlockCount܂Ƃ߂ĊmۂA󂢂ubNg܂킷
+	// ̌܂ȃReiƂp(1̃Rei1ubNgAubN̒ŐLяk݂)
+	// XbhZ[tł͂Ȃ
+	class FixedPool
+	{
+	public:
+		FixedPool(uint64 blockSize, uint32 blockCount)
+			: _BlockSize{ AlignAllocationUp(std::max<uint64>(blockSize, sizeof(void*)), alignof(std::max_align_t)) }, _BlockCount{ blockCount }
+		{
+			assert(blockSize && blockCount);
+			_Buffer = static_cast<uint8*>(malloc(_BlockSize * blockCount));
+			assert(_Buffer);
+
+			// 擪̃ubN珇Ɏg悤Ɍ납󂫃XgɌq
+			for (uint32 i = blockCount; i > 0; i--)
+			{
+				void* const block{ _Buffer + _BlockSize * (i - 1) };
+				*static_cast<void**>(block) = _NextFree;
+				_NextFree = block;
+			}
+		}
+
+		FixedPool(const FixedPool&) = delete;
+		FixedPool& operator=(const FixedPool&) = delete;
+
+		~FixedPool()
+		{
+			assert(!_Used);
+			free(_Buffer);
+		}
+
+		[[nodiscard]] void* Allocate()
+		{
+			assert(_NextFree && "FixedPool̃ubN܂");
+			void* const block{ _NextFree };
+			if (block)
+			{
+				_NextFree = *static_cast<void**>(block);
+				_Used++;
+			}
+			return block;
+		}
+
+		void Deallocate(void* const block)
+		{
+			assert(block >= _Buffer && block < _Buffer + _BlockSize * _BlockCount);
+			assert(((static_cast<uint8*>(block) - _Buffer) % _BlockSize) == 0);
+			*static_cast<void**>(block) = _NextFree;
+			_NextFree = block;
+			_Used--;
+		}
+
+		[[nodiscard]] constexpr uint64 BlockSize() const { return _BlockSize; }
+		[[nodiscard]] constexpr uint32 UsedCount() const { return _Used; }
+
+	private:
+		uint8* _Buffer = nullptr;
+		void* _NextFree = nullptr;
+		uint64 _BlockSize;
+		uint32 _BlockCount;
+		uint32 _Used = 0;
+	};
+
+	struct PoolAllocator
+	{
+		FixedPool* Pool = nullptr;
+
+		// ubN̑傫܂ł͂̏ŐLяk݂
+		// Vector͖1.5{LтăubN𒴂邱Ƃ̂ŁAŏɃubNɓ鐔reserve()Ă
+		[[nodiscard]] void* Reallocate(void* const data, [[maybe_unused]] uint64 oldSize, uint64 newSize, [[maybe_unused]] uint64 alignment)
+		{
+			assert(Pool && newSize <= Pool->BlockSize() && "FixedPool̃ubN傫͂ł܂");
+			assert(alignment <= alignof(std::max_align_t));
+			return data ? data : Pool->Allocate();
+		}
+
+		void Deallocate(void* const data, [[maybe_unused]] uint64 size)
+		{
+			if (data)
+			{
+				assert(Pool);
+				Pool->Deallocate(data);
+			}
+		}
+	};
+}
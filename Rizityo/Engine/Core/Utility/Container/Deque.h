@@ -0,0 +1,298 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace Rizityo
+{
+	// 2ׂ̂̑傫̃Oobt@ɗvfׂ闼[L[
+	// tɂȂƂ2{ɍL̂ŁAǉƍ폜JԂ̒Ԃł̓q[v̊mۂNȂ
+	// VectorƓALƂ͗vfmemcpyňڂ
+	template<typename T>
+	class Deque
+	{
+	public:
+		using value_type = T;
+
+		Deque() = default;
+
+		explicit Deque(uint64 capacity)
+		{
+			reserve(capacity);
+		}
+
+		Deque(const Deque& other)
+		{
+			*this = other;
+		}
+
+		Deque(Deque&& other) : _Data{ other._Data }, _Capacity{ other._Capacity }, _Head{ other._Head }, _Size{ other._Size }
+		{
+			other.Reset();
+		}
+
+		~Deque()
+		{
+			Destroy();
+		}
+
+		Deque& operator=(const Deque& other)
+		{
+			assert(this != std::addressof(other));
+			if (this != std::addressof(other))
+			{
+				clear();
+				reserve(other._Size);
+				for (uint64 i = 0; i < other._Size; i++)
+				{
+					emplace_back(other[i]);
+				}
+			}
+			return *this;
+		}
+
+		Deque& operator=(Deque&& other)
+		{
+			assert(this != std::addressof(other));
+			if (this != std::addressof(other))
+			{
+				Destroy();
+				_Data = other._Data;
+				_Capacity = other._Capacity;
+				_Head = other._Head;
+				_Size = other._Size;
+				other.Reset();
+			}
+			return *this;
+		}
+
+		void push_back(const T& value)
+		{
+			emplace_back(value);
+		}
+
+		void push_back(T&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		// count܂Ƃ߂Ėɒǉ
+		void push_back(const T* const items, uint64 count)
+		{
+			assert(items || !count);
+			reserve(_Size + count);
+			uint64 done{ 0 };
+			while (done < count)
+			{
+				// ܂ԂO܂őď
+				const uint64 index{ Wrap(_Head + _Size) };
+				const uint64 n{ std::min(count - done, _Capacity - index) };
+				CopyConstruct(&_Data[index], &items[done], n);
+				_Size += n;
+				done += n;
+			}
+		}
+
+		template<typename... Params>
+		T& emplace_back(Params&&... params)
+		{
+			if (_Size == _Capacity)
+			{
+				Grow(_Size + 1);
+			}
+			T* const item{ new (&_Data[Wrap(_Head + _Size)]) T(std::forward<Params>(params)...) };
+			_Size++;
+			return *item;
+		}
+
+		void push_front(const T& value)
+		{
+			emplace_front(value);
+		}
+
+		template<typename... Params>
+		T& emplace_front(Params&&... params)
+		{
+			if (_Size == _Capacity)
+			{
+				Grow(_Size + 1);
+			}
+			_Head = Wrap(_Head + _Capacity - 1);
+			_Size++;
+			return *new (&_Data[_Head]) T(std::forward<Params>(params)...);
+		}
+
+		void pop_front()
+		{
+			assert(_Size);
+			_Data[_Head].~T();
+			_Head = Wrap(_Head + 1);
+			_Size--;
+		}
+
+		// 擪countitemsɈڂĎ菜
+		void pop_front(OUT T* const items, uint64 count)
+		{
+			assert(items && count <= _Size);
+			uint64 done{ 0 };
+			while (done < count)
+			{
+				const uint64 n{ std::min(count - done, _Capacity - _Head) };
+				MoveOut(&items[done], &_Data[_Head], n);
+				_Head = Wrap(_Head + n);
+				_Size -= n;
+				done += n;
+			}
+		}
+
+		void pop_back()
+		{
+			assert(_Size);
+			_Size--;
+			_Data[Wrap(_Head + _Size)].~T();
+		}
+
+		[[nodiscard]] T& front()
+		{
+			assert(_Size);
+			return _Data[_Head];
+		}
+
+		[[nodiscard]] const T& front() const
+		{
+			assert(_Size);
+			return _Data[_Head];
+		}
+
+		[[nodiscard]] T& back()
+		{
+			assert(_Size);
+			return _Data[Wrap(_Head + _Size - 1)];
+		}
+
+		[[nodiscard]] const T& back() const
+		{
+			assert(_Size);
+			return _Data[Wrap(_Head + _Size - 1)];
+		}
+
+		// 擪indexԖ
+		[[nodiscard]] T& operator[](uint64 index)
+		{
+			assert(index < _Size);
+			return _Data[Wrap(_Head + index)];
+		}
+
+		[[nodiscard]] const T& operator[](uint64 index) const
+		{
+			assert(index < _Size);
+			return _Data[Wrap(_Head + index)];
+		}
+
+		void reserve(uint64 capacity)
+		{
+			if (capacity > _Capacity)
+			{
+				Grow(capacity);
+			}
+		}
+
+		void clear()
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (uint64 i = 0; i < _Size; i++)
+				{
+					_Data[Wrap(_Head + i)].~T();
+				}
+			}
+			_Head = 0;
+			_Size = 0;
+		}
+
+		[[nodiscard]] constexpr uint64 size() const { return _Size; }
+		[[nodiscard]] constexpr bool empty() const { return _Size == 0; }
+		[[nodiscard]] constexpr uint64 capacity() const { return _Capacity; }
+
+	private:
+		T* _Data = nullptr;
+		uint64 _Capacity = 0; // 02ׂ̂
+		uint64 _Head = 0; // 擪̗vf̏ꏊ
+		uint64 _Size = 0;
+
+		[[nodiscard]] constexpr uint64 Wrap(uint64 index) const
+		{
+			return index & (_Capacity - 1);
+		}
+
+		// ȂƂminCapacity悤2{LAvf擪lߒ
+		void Grow(uint64 minCapacity)
+		{
+			uint64 capacity{ _Capacity ? _Capacity * 2 : 8 };
+			while (capacity < minCapacity)
+			{
+				capacity *= 2;
+			}
+
+			T* const data{ static_cast<T*>(malloc(capacity * sizeof(T))) };
+			assert(data);
+			if (_Size)
+			{
+				// ܂ԂĂꍇ͌딼ƑO2ɕĈڂ
+				const uint64 first{ std::min(_Size, _Capacity - _Head) };
+				memcpy(data, &_Data[_Head], first * sizeof(T));
+				memcpy(&data[first], _Data, (_Size - first) * sizeof(T));
+			}
+			free(_Data);
+			_Data = data;
+			_Capacity = capacity;
+			_Head = 0;
+		}
+
+		static void CopyConstruct(T* const dst, const T* const src, uint64 count)
+		{
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				memcpy(dst, src, count * sizeof(T));
+			}
+			else
+			{
+				for (uint64 i = 0; i < count; i++)
+				{
+					new (&dst[i]) T(src[i]);
+				}
+			}
+		}
+
+		static void MoveOut(T* const dst, T* const src, uint64 count)
+		{
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				memcpy(dst, src, count * sizeof(T));
+			}
+			else
+			{
+				for (uint64 i = 0; i < count; i++)
+				{
+					dst[i] = std::move(src[i]);
+					src[i].~T();
+				}
+			}
+		}
+
+		void Destroy()
+		{
+			clear();
+			free(_Data);
+			Reset();
+		}
+
+		void Reset()
+		{
+			_Data = nullptr;
+			_Capacity = 0;
+			_Head = 0;
+			_Size = 0;
+		}
+	};
+}
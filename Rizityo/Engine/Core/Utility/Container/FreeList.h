@@ -1,19 +1,101 @@
 #pragma once
 #include "CommonHeaders.h"
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace Rizityo
 {
-	template<typename T>
+	// 폜ꏊ̒ǉŎg܂킷z
+	// gĂꏊrbg}bv(1vf1rbg)ƁA64rbgƂɋłȂ̃rbg}bv2iŎ̂ŁA
+	// Ăvf𐔂ɔႵԂŏɉ񂹂(ForEach, ͈for)
+	// Allocator͒̔zƃrbg}bvɓn(VectorƓ)
+	template<typename T, typename Allocator = MallocAllocator>
 	class FreeList
 	{
 		static_assert(sizeof(T) >= sizeof(uint32));
 
+		[[nodiscard]] static uint32 LowestBit(uint64 bits)
+		{
+			assert(bits);
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward64(&index, bits);
+			return (uint32)index;
+#else
+			return (uint32)__builtin_ctzll(bits);
+#endif
+		}
+
 	public:
+		// ĂvfO珇ɕԂ
+		template<bool IsConst>
+		class IteratorBase
+		{
+		public:
+			using List = std::conditional_t<IsConst, const FreeList, FreeList>;
+			using Value = std::conditional_t<IsConst, const T, T>;
+
+			IteratorBase(List* list, uint32 index) : _List{ list }, _Index{ list->NextOccupied(index, list->Capacity()) } {}
+
+			[[nodiscard]] Value& operator*() const { return _List->_Array[_Index]; }
+			[[nodiscard]] Value* operator->() const { return &_List->_Array[_Index]; }
+
+			// vf̃CfbNX(AddŕԂ)
+			[[nodiscard]] uint32 Index() const { return _Index; }
+
+			IteratorBase& operator++()
+			{
+				_Index = _List->NextOccupied(_Index + 1, _List->Capacity());
+				return *this;
+			}
+
+			[[nodiscard]] bool operator==(const IteratorBase& other) const { return _Index == other._Index; }
+			[[nodiscard]] bool operator!=(const IteratorBase& other) const { return _Index != other._Index; }
+
+		private:
+			List* _List;
+			uint32 _Index;
+		};
+
+		using iterator = IteratorBase<false>;
+		using const_iterator = IteratorBase<true>;
+
 		FreeList() = default;
 
+		explicit FreeList(const Allocator& allocator) : _Array{ allocator }, _Occupancy{ allocator }, _Summary{ allocator } {}
+
 		explicit FreeList(uint32 capacity)
 		{
 			_Array.reserve(capacity);
+			_Occupancy.reserve((capacity + 63) / 64);
+		}
+
+		FreeList(const FreeList&) = delete;
+		FreeList& operator=(const FreeList&) = delete;
+
+		// HashMapȂǂ̍Ċmۂŗvfƈڂ悤ɂ
+		FreeList(FreeList&& other) noexcept
+			: _Array{ std::move(other._Array) }, _Occupancy{ std::move(other._Occupancy) }, _Summary{ std::move(other._Summary) },
+			_Size{ other._Size }, _NextFreeIndex{ other._NextFreeIndex }
+		{
+			other._Size = 0;
+			other._NextFreeIndex = UINT32_INVALID_NUM;
+		}
+
+		FreeList& operator=(FreeList&& other) noexcept
+		{
+			assert(this != std::addressof(other) && !_Size);
+			_Array = std::move(other._Array);
+			_Occupancy = std::move(other._Occupancy);
+			_Summary = std::move(other._Summary);
+			_Size = other._Size;
+			_NextFreeIndex = other._NextFreeIndex;
+			other._Size = 0;
+			other._NextFreeIndex = UINT32_INVALID_NUM;
+			return *this;
 		}
 
 		~FreeList()
@@ -30,6 +112,14 @@ namespace Rizityo
 			{
 				index = (uint32)_Array.size();
 				_Array.emplace_back(std::forward<Args>(args)...);
+				if (index % 64 == 0)
+				{
+					_Occupancy.emplace_back(0);
+				}
+				if (index % (64 * 64) == 0)
+				{
+					_Summary.emplace_back(0);
+				}
 			}
 			else
 			{
@@ -38,6 +128,8 @@ namespace Rizityo
 				_NextFreeIndex = *reinterpret_cast<const uint32* const>(std::addressof(_Array[index])); // 4oCgɎFreeIndexĂ
 				new (std::addressof(_Array[index])) T(std::forward<Args>(args)...);
 			}
+			_Occupancy[index / 64] |= (uint64)1 << (index % 64);
+			_Summary[index / (64 * 64)] |= (uint64)1 << ((index / 64) % 64);
 			_Size++;
 			return index;
 		}
@@ -51,6 +143,13 @@ namespace Rizityo
 			*reinterpret_cast<uint32* const>(std::addressof(_Array[index])) = _NextFreeIndex; // 4oCgɎFreeIndex
 			_NextFreeIndex = index;
 			_Size--;
+
+			uint64& word{ _Occupancy[index / 64] };
+			word &= ~((uint64)1 << (index % 64));
+			if (!word)
+			{
+				_Summary[index / (64 * 64)] &= ~((uint64)1 << ((index / 64) % 64));
+			}
 		}
 
 		constexpr uint32 Size() const
@@ -68,6 +167,12 @@ namespace Rizityo
 			return _Size == 0;
 		}
 
+		[[nodiscard]] constexpr bool IsOccupied(uint32 index) const
+		{
+			assert(index < _Array.size());
+			return (_Occupancy[index / 64] >> (index % 64)) & 1;
+		}
+
 		[[nodiscard]] constexpr T& operator[](uint32 index)
 		{
 			assert(index < _Array.size() && !AlreadyRemoved(index));
@@ -80,28 +185,72 @@ namespace Rizityo
 			return _Array[index];
 		}
 
+		[[nodiscard]] iterator begin() { return iterator{ this, 0 }; }
+		[[nodiscard]] iterator end() { return iterator{ this, Capacity() }; }
+		[[nodiscard]] const_iterator begin() const { return const_iterator{ this, 0 }; }
+		[[nodiscard]] const_iterator end() const { return const_iterator{ this, Capacity() }; }
+
+		// [begin, end)̃CfbNX̂ĂvfƂfunc(index, item)Ă
+		// JobSystem::ParallelFor(Capacity(), chunkSize, ...)̃`N͈̔͂̂܂ܓnΕɉ񂹂
+		template<typename Func>
+		void ForEach(uint32 begin, uint32 end, Func&& func)
+		{
+			assert(begin <= end && end <= Capacity());
+			for (uint32 index{ NextOccupied(begin, end) }; index < end; index = NextOccupied(index + 1, end))
+			{
+				func(index, _Array[index]);
+			}
+		}
+
+		template<typename Func>
+		void ForEach(Func&& func)
+		{
+			ForEach(0, Capacity(), std::forward<Func>(func));
+		}
+
 	private:
-		Vector<T, false> _Array;
+		Vector<T, false, Allocator> _Array;
+		Vector<uint64, true, Allocator> _Occupancy; // 1rbg1vf(Ă1)
+		Vector<uint64, true, Allocator> _Summary; // 1rbg_Occupancy1vf(0łȂ1)
 		uint32 _Size = 0;
 		uint32 _NextFreeIndex = UINT32_INVALID_NUM;
 
-		constexpr bool AlreadyRemoved(uint32 index) const
+		// indexȍ~ōŏ̐Ăvf(Ȃend)
+		// 0_Occupancy_Summary64΂̂ŁA󂢂ĂꏊĂĂvf̐ɔႵԂōς
+		[[nodiscard]] uint32 NextOccupied(uint32 index, uint32 end) const
 		{
-			// sizeof(T) == sizeof(uint32)̂Ƃ͂̃eXg͂łȂ
-			if constexpr (sizeof(T) > sizeof(uint32))
+			uint32 word{ index / 64 };
+			const uint32 wordCount{ (end + 63) / 64 };
+			if (word >= wordCount)
+				return end;
+
+			// indexÕrbg𗎂ƂĂT
+			uint64 bits{ _Occupancy[word] & (~(uint64)0 << (index % 64)) };
+			while (!bits)
 			{
-				uint32 i = (sizeof(uint32));
-				const uint8* const p = reinterpret_cast<const uint8* const>(std::addressof(_Array[index]));
-				while ((p[i] == 0xcc) && (i < sizeof(T)))
+				// 0łȂ_Occupancy_SummaryT
+				word++;
+				uint32 summaryIndex{ word / 64 };
+				uint64 summary{ summaryIndex < _Summary.size() ? _Summary[summaryIndex] & (~(uint64)0 << (word % 64)) : 0 };
+				while (!summary)
 				{
-					i++;
+					if (++summaryIndex * 64 >= wordCount)
+						return end;
+					summary = _Summary[summaryIndex];
 				}
-				return i == sizeof(T);
-			}
-			else
-			{
-				return true;
+				word = summaryIndex * 64 + LowestBit(summary);
+				if (word >= wordCount)
+					return end;
+				bits = _Occupancy[word];
 			}
+
+			const uint32 next{ word * 64 + LowestBit(bits) };
+			return next < end ? next : end;
+		}
+
+		constexpr bool AlreadyRemoved(uint32 index) const
+		{
+			return !IsOccupied(index);
 		}
 	};
-}
\ No newline at end of file
+}
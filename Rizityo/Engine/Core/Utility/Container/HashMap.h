@@ -0,0 +1,465 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <algorithm>
+#include <cstddef>
+#include <emmintrin.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Rizityo
+{
+	// L[̃nbV(E񋓌^E|C^std::hashʂɂ̂܂܍)
+	// std::hash͐̂܂ܕԂAʃrbgŏꏊ߂Ƃ̂ŕK
+	template<typename K>
+	struct HashMapHash
+	{
+		[[nodiscard]] static constexpr uint64 Mix(uint64 x)
+		{
+			x ^= x >> 33;
+			x *= 0xff51'afd7'ed55'8ccdull;
+			x ^= x >> 33;
+			x *= 0xc4ce'b9fe'1a85'ec53ull;
+			x ^= x >> 33;
+			return x;
+		}
+
+		[[nodiscard]] uint64 operator()(const K& key) const
+		{
+			if constexpr (std::is_integral_v<K> || std::is_enum_v<K>)
+			{
+				return Mix((uint64)key);
+			}
+			else if constexpr (std::is_pointer_v<K>)
+			{
+				return Mix((uint64)reinterpret_cast<uintptr_t>(key));
+			}
+			else
+			{
+				return Mix((uint64)std::hash<K>{}(key));
+			}
+		}
+	};
+
+	// I[vAhX@̃nbV}bv(Swiss Table)
+	// vfƂ1oCg̐oCg(󂫁E폜ς݁EnbV̉7rbg)A16̐oCgSSE2ł܂Ƃ߂ĔׂČi
+	// vf̓m[h炸ɔzɒڒûŁAǉE폜EĊmۂő̗vf̏ꏊ(Ce[^[|C^[)͕ς肤
+	// std::unordered_mapƓł悤ɁAgĂ֐OɂĂ
+	template<typename K, typename V, typename Hash = HashMapHash<K>>
+	class HashMap
+	{
+	public:
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<const K, V>;
+
+	private:
+		static_assert(alignof(value_type) <= alignof(std::max_align_t), "mallocŊmۂłACg𒴂Ă܂");
+
+		static constexpr uint32 GroupWidth = 16;
+		static constexpr int8 Empty = -128; // 0b10000000
+		static constexpr int8 Deleted = -2; // 0b11111110
+		// ܂Ăvf̐oCg̓nbV̉7rbg(0 ~ 127)Ȃ̂ŁAŏʃrbgĂ΋󂫂폜ς
+
+		// oCg16(erbg1vf)
+		struct Group
+		{
+			__m128i Ctrl;
+
+			explicit Group(const int8* const ctrl) : Ctrl{ _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl)) } {}
+
+			[[nodiscard]] uint32 Match(int8 h2) const
+			{
+				return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), Ctrl));
+			}
+
+			[[nodiscard]] uint32 MatchEmpty() const
+			{
+				return Match(Empty);
+			}
+
+			[[nodiscard]] uint32 MatchEmptyOrDeleted() const
+			{
+				return (uint32)_mm_movemask_epi8(Ctrl);
+			}
+		};
+
+		[[nodiscard]] static uint32 LowestBit(uint32 mask)
+		{
+			assert(mask);
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return (uint32)index;
+#else
+			return (uint32)__builtin_ctz(mask);
+#endif
+		}
+
+		[[nodiscard]] static constexpr int8 H2(uint64 hash) { return (int8)(hash & 0x7f); }
+		[[nodiscard]] static constexpr uint64 H1(uint64 hash) { return hash >> 7; }
+
+		template<bool IsConst>
+		class IteratorBase
+		{
+		public:
+			using Map = std::conditional_t<IsConst, const HashMap, HashMap>;
+			using Value = std::conditional_t<IsConst, const value_type, value_type>;
+
+			IteratorBase() = default;
+			IteratorBase(Map* map, uint32 index) : _Map{ map }, _Index{ index }
+			{
+				SkipEmpty();
+			}
+
+			// iteratorconst_iteratorւ̕ϊ
+			template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+			IteratorBase(const IteratorBase<OtherConst>& other) : _Map{ other._Map }, _Index{ other._Index } {}
+
+			[[nodiscard]] Value& operator*() const { return _Map->_Slots[_Index]; }
+			[[nodiscard]] Value* operator->() const { return &_Map->_Slots[_Index]; }
+
+			IteratorBase& operator++()
+			{
+				_Index++;
+				SkipEmpty();
+				return *this;
+			}
+
+			[[nodiscard]] bool operator==(const IteratorBase& other) const { return _Index == other._Index; }
+			[[nodiscard]] bool operator!=(const IteratorBase& other) const { return _Index != other._Index; }
+
+		private:
+			friend class HashMap;
+			template<bool> friend class IteratorBase;
+
+			Map* _Map = nullptr;
+			uint32 _Index = 0;
+
+			void SkipEmpty()
+			{
+				while (_Index < _Map->_Capacity && _Map->_Ctrl[_Index] < 0)
+				{
+					_Index++;
+				}
+			}
+		};
+
+	public:
+		using iterator = IteratorBase<false>;
+		using const_iterator = IteratorBase<true>;
+
+		HashMap() = default;
+		HashMap(const HashMap&) = delete;
+		HashMap& operator=(const HashMap&) = delete;
+
+		HashMap(HashMap&& other) noexcept
+		{
+			Move(other);
+		}
+
+		HashMap& operator=(HashMap&& other) noexcept
+		{
+			assert(this != std::addressof(other));
+			if (this != std::addressof(other))
+			{
+				Destroy();
+				Move(other);
+			}
+			return *this;
+		}
+
+		~HashMap()
+		{
+			Destroy();
+		}
+
+		[[nodiscard]] iterator begin() { return iterator{ this, 0 }; }
+		[[nodiscard]] iterator end() { return iterator{ this, _Capacity }; }
+		[[nodiscard]] const_iterator begin() const { return const_iterator{ this, 0 }; }
+		[[nodiscard]] const_iterator end() const { return const_iterator{ this, _Capacity }; }
+
+		[[nodiscard]] constexpr uint64 size() const { return _Size; }
+		[[nodiscard]] constexpr bool empty() const { return _Size == 0; }
+		[[nodiscard]] constexpr uint64 capacity() const { return _Capacity; }
+
+		[[nodiscard]] iterator find(const K& key)
+		{
+			return iterator{ this, FindIndex(key, Hash{}(key)) };
+		}
+
+		[[nodiscard]] const_iterator find(const K& key) const
+		{
+			return const_iterator{ this, FindIndex(key, Hash{}(key)) };
+		}
+
+		[[nodiscard]] uint64 count(const K& key) const
+		{
+			return FindIndex(key, Hash{}(key)) != _Capacity;
+		}
+
+		// L[ȂVĒǉ(ΉȂ)
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+		{
+			const uint64 hash{ Hash{}(key) };
+			uint32 index{ FindIndex(key, hash) };
+			if (index != _Capacity)
+				return { iterator{ this, index }, false };
+
+			index = PrepareInsert(hash);
+			new (&_Slots[index]) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { iterator{ this, index }, true };
+		}
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(const K& key, Args&&... args)
+		{
+			return try_emplace(key, std::forward<Args>(args)...);
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			return try_emplace(value.first, value.second);
+		}
+
+		std::pair<iterator, bool> insert(value_type&& value)
+		{
+			return try_emplace(value.first, std::move(value.second));
+		}
+
+		V& operator[](const K& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		uint64 erase(const K& key)
+		{
+			const uint32 index{ FindIndex(key, Hash{}(key)) };
+			if (index == _Capacity)
+				return 0;
+
+			EraseAt(index);
+			return 1;
+		}
+
+		void erase(const_iterator iter)
+		{
+			assert(iter._Map == this && iter._Index < _Capacity && _Ctrl[iter._Index] >= 0);
+			EraseAt(iter._Index);
+		}
+
+		void clear()
+		{
+			DestroySlots();
+			if (_Capacity)
+			{
+				memset(_Ctrl, Empty, _Capacity);
+			}
+			_Size = 0;
+			_GrowthLeft = MaxLoad(_Capacity);
+		}
+
+		// vfcountɂȂ܂ōĊmۂȂŒǉł悤ɂ
+		void reserve(uint64 count)
+		{
+			if (count > (uint64)_Size + _GrowthLeft)
+			{
+				Rehash(std::max(CapacityFor(count), _Capacity));
+			}
+		}
+
+	private:
+		int8* _Ctrl = nullptr; // _Capacity̐oCg(16oCgE)
+		value_type* _Slots = nullptr; // _CtrľɓmۂŒu
+		uint32 _Capacity = 0; // 0GroupWidth̔{2ׂ̂
+		uint32 _Size = 0;
+		uint32 _DeletedCount = 0;
+		uint32 _GrowthLeft = 0; // (폜ς݂͊܂܂Ȃ)𖄂߂c̐
+
+		// 7/8܂Ŗ߂
+		[[nodiscard]] static constexpr uint32 MaxLoad(uint32 capacity)
+		{
+			return capacity - capacity / 8;
+		}
+
+		[[nodiscard]] static uint32 CapacityFor(uint64 count)
+		{
+			uint32 capacity{ GroupWidth };
+			while (MaxLoad(capacity) < count)
+			{
+				assert(capacity < (1u << 31));
+				capacity *= 2;
+			}
+			return capacity;
+		}
+
+		// O[vPʂŎOp̊ԊuŒT(O[v2ׂ̂Ȃ̂őSẴO[v1xʂ)
+		template<typename Func>
+		uint32 Probe(uint64 hash, Func&& func) const
+		{
+			assert(_Capacity);
+			const uint32 groupMask{ _Capacity / GroupWidth - 1 };
+			uint32 group{ (uint32)H1(hash) & groupMask };
+			for (uint32 step = 1; ; step++)
+			{
+				const uint32 offset{ group * GroupWidth };
+				const uint32 index{ func(offset, Group{ _Ctrl + offset }) };
+				if (index != UINT32_INVALID_NUM)
+					return index;
+
+				assert(step <= groupMask + 1);
+				group = (group + step) & groupMask;
+			}
+		}
+
+		// Ȃ_CapacityԂ
+		[[nodiscard]] uint32 FindIndex(const K& key, uint64 hash) const
+		{
+			if (!_Size)
+				return _Capacity;
+
+			const int8 h2{ H2(hash) };
+			return Probe(hash, [this, &key, h2](uint32 offset, const Group& group)
+			{
+				for (uint32 match{ group.Match(h2) }; match; match &= match - 1)
+				{
+					const uint32 index{ offset + LowestBit(match) };
+					if (_Slots[index].first == key)
+						return index;
+				}
+				// 󂫂O[vɂ͒uĂȂ
+				return group.MatchEmpty() ? _Capacity : UINT32_INVALID_NUM;
+			});
+		}
+
+		[[nodiscard]] uint32 FindFirstNonFull(uint64 hash) const
+		{
+			return Probe(hash, [](uint32 offset, const Group& group)
+			{
+				const uint32 match{ group.MatchEmptyOrDeleted() };
+				return match ? offset + LowestBit(match) : UINT32_INVALID_NUM;
+			});
+		}
+
+		// hash̗vfuꏊ󂯂ĐoCgAꏊԂ(vf͌Ăяoō\z)
+		uint32 PrepareInsert(uint64 hash)
+		{
+			uint32 index{ _Capacity ? FindFirstNonFull(hash) : 0 };
+			if (!_Capacity || (!_GrowthLeft && _Ctrl[index] == Empty))
+			{
+				// 폜ς݂Γ傫ŋlߒAłȂ΍L
+				if (!_Capacity)
+				{
+					Rehash(GroupWidth);
+				}
+				else
+				{
+					Rehash(((uint64)_Size * 32 > (uint64)_Capacity * 25) ? _Capacity * 2 : _Capacity);
+				}
+				index = FindFirstNonFull(hash);
+			}
+
+			if (_Ctrl[index] == Empty)
+			{
+				assert(_GrowthLeft);
+				_GrowthLeft--;
+			}
+			else
+			{
+				assert(_Ctrl[index] == Deleted);
+				_DeletedCount--;
+			}
+			_Ctrl[index] = H2(hash);
+			_Size++;
+			return index;
+		}
+
+		void EraseAt(uint32 index)
+		{
+			_Slots[index].~value_type();
+			_Ctrl[index] = Deleted;
+			_Size--;
+			_DeletedCount++;
+		}
+
+		void Rehash(uint32 newCapacity)
+		{
+			assert(newCapacity >= GroupWidth && MaxLoad(newCapacity) >= _Size);
+			int8* const oldCtrl{ _Ctrl };
+			value_type* const oldSlots{ _Slots };
+			const uint32 oldCapacity{ _Capacity };
+
+			// oCg̑傫GroupWidth̔{Ȃ̂ŁAɑvf̔z16oCgEɑ
+			uint8* const memory{ static_cast<uint8*>(malloc((uint64)newCapacity * (1 + sizeof(value_type)))) };
+			assert(memory && ((uintptr_t)memory % GroupWidth) == 0);
+			_Ctrl = reinterpret_cast<int8*>(memory);
+			_Slots = reinterpret_cast<value_type*>(memory + newCapacity);
+			_Capacity = newCapacity;
+			memset(_Ctrl, Empty, newCapacity);
+			_GrowthLeft = MaxLoad(newCapacity) - _Size;
+			_DeletedCount = 0;
+
+			for (uint32 i = 0; i < oldCapacity; i++)
+			{
+				if (oldCtrl[i] < 0)
+					continue;
+
+				value_type& item{ oldSlots[i] };
+				const uint64 hash{ Hash{}(item.first) };
+				const uint32 index{ FindFirstNonFull(hash) };
+				_Ctrl[index] = H2(hash);
+				new (&_Slots[index]) value_type(item.first, std::move(item.second));
+				item.~value_type();
+			}
+			free(oldCtrl);
+		}
+
+		void DestroySlots()
+		{
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+				for (uint32 i = 0; i < _Capacity; i++)
+				{
+					if (_Ctrl[i] >= 0)
+					{
+						_Slots[i].~value_type();
+					}
+				}
+			}
+			_DeletedCount = 0;
+		}
+
+		void Destroy()
+		{
+			DestroySlots();
+			free(_Ctrl);
+			Reset();
+		}
+
+		void Move(HashMap& other)
+		{
+			_Ctrl = other._Ctrl;
+			_Slots = other._Slots;
+			_Capacity = other._Capacity;
+			_Size = other._Size;
+			_DeletedCount = other._DeletedCount;
+			_GrowthLeft = other._GrowthLeft;
+			other.Reset();
+		}
+
+		void Reset()
+		{
+			_Ctrl = nullptr;
+			_Slots = nullptr;
+			_Capacity = 0;
+			_Size = 0;
+			_DeletedCount = 0;
+			_GrowthLeft = 0;
+		}
+	};
+}
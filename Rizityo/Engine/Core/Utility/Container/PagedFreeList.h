@@ -0,0 +1,154 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Rizityo
+{
+	// PageSizemۂy[WɗvfuFreeList
+	// y[W͔j܂œȂ̂ŁAvf̃AhX͍폜܂ŕςȂ
+	// vf̏PageSize * MaxPagesŁAƃ[Xrhłabort()
+	// AddERemove͌Ăяo1Xbhɂ邱(bNȂ)
+	// operator[]AddERemoveƓɕʂ̃XbhĂł悢(AddŕԂCfbNX󂯎ĂāA܂RemoveĂȂvfɌ)
+	template<typename T, uint32 PageSize = 1024, uint32 MaxPages = 1024>
+	class PagedFreeList
+	{
+		static_assert(sizeof(T) >= sizeof(uint32));
+		static_assert(PageSize && (PageSize & (PageSize - 1)) == 0, "PageSize2ׂ̂łKv܂");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "mallocŊmۂłACg𒴂Ă܂");
+
+	public:
+		PagedFreeList() = default;
+		PagedFreeList(const PagedFreeList&) = delete;
+		PagedFreeList& operator=(const PagedFreeList&) = delete;
+
+		~PagedFreeList()
+		{
+			assert(!_Size);
+			for (uint32 i = 0; i < MaxPages; i++)
+			{
+				free(_Pages[i].load(std::memory_order_relaxed));
+			}
+		}
+
+		// vfǉCfbNXԂ
+		template<class... Args>
+		uint32 Add(Args&&... args)
+		{
+			uint32 index = UINT32_INVALID_NUM;
+			if (_NextFreeIndex == UINT32_INVALID_NUM)
+			{
+				index = _Count;
+				if (index % PageSize == 0)
+				{
+					AddPage(index / PageSize);
+				}
+				new (&Get(index)) T(std::forward<Args>(args)...);
+				_Count++;
+			}
+			else
+			{
+				index = _NextFreeIndex;
+				assert(index < _Count && AlreadyRemoved(Get(index)));
+				_NextFreeIndex = *reinterpret_cast<const uint32* const>(&Get(index)); // 4oCgɎFreeIndexĂ
+				new (&Get(index)) T(std::forward<Args>(args)...);
+			}
+			_Size++;
+			return index;
+		}
+
+		void Remove(uint32 index)
+		{
+			assert(index < _Count && !AlreadyRemoved(Get(index)));
+			T& item{ Get(index) };
+			item.~T();
+			DEBUG_ONLY(memset(&item, 0xcc, sizeof(T)));
+			*reinterpret_cast<uint32* const>(&item) = _NextFreeIndex; // 4oCgɎFreeIndex
+			_NextFreeIndex = index;
+			_Size--;
+		}
+
+		[[nodiscard]] constexpr uint32 Size() const
+		{
+			return _Size;
+		}
+
+		// ǉƂ̂CfbNX̐(폜ς݂܂)
+		[[nodiscard]] constexpr uint32 Capacity() const
+		{
+			return _Count;
+		}
+
+		[[nodiscard]] constexpr bool IsEmpty() const
+		{
+			return _Size == 0;
+		}
+
+		[[nodiscard]] T& operator[](uint32 index)
+		{
+			assert(!AlreadyRemoved(Get(index)));
+			return Get(index);
+		}
+
+		[[nodiscard]] const T& operator[](uint32 index) const
+		{
+			assert(!AlreadyRemoved(Get(index)));
+			return Get(index);
+		}
+
+	private:
+		// y[WAddXbhAǂރXbhacquireŎ󂯎
+		std::atomic<T*> _Pages[MaxPages]{};
+		uint32 _Count = 0;
+		uint32 _Size = 0;
+		uint32 _NextFreeIndex = UINT32_INVALID_NUM;
+
+		[[nodiscard]] T& Get(uint32 index) const
+		{
+			assert(index / PageSize < MaxPages);
+			T* const page{ _Pages[index / PageSize].load(std::memory_order_acquire) };
+			assert(page);
+			return page[index % PageSize];
+		}
+
+		void AddPage(uint32 page)
+		{
+			assert(page < MaxPages && "y[W̐𒴂܂");
+			// y[W̕\͌Œ蒷Ȃ̂ŁAassert̖[Xrhł͈͊OɏޑOɎ~߂
+			if (page >= MaxPages)
+			{
+				fprintf(stderr, "PagedFreeList: vf(%u)𒴂܂\n", PageSize * MaxPages);
+				std::abort();
+			}
+
+			T* const data{ static_cast<T*>(malloc(sizeof(T) * PageSize)) };
+			if (!data)
+			{
+				fprintf(stderr, "PagedFreeList: y[Wmۂł܂ł\n");
+				std::abort();
+			}
+			_Pages[page].store(data, std::memory_order_release);
+		}
+
+		static bool AlreadyRemoved(const T& item)
+		{
+			// sizeof(T) == sizeof(uint32)̂Ƃ͂̃eXg͂łȂ
+			if constexpr (sizeof(T) > sizeof(uint32))
+			{
+				uint32 i = (sizeof(uint32));
+				const uint8* const p = reinterpret_cast<const uint8* const>(&item);
+				while ((i < sizeof(T)) && (p[i] == 0xcc))
+				{
+					i++;
+				}
+				return i == sizeof(T);
+			}
+			else
+			{
+				return true;
+			}
+		}
+	};
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <cstddef>
+
+namespace Rizityo
+{
+	// ^̗vfPageSize܂Ƃ߂Ċmۂy[W(Xu)犄蓖Ă
+	// ꏊ͎̊蓖ĂŎg܂킵Ay[W͔j܂ŉȂ̂ŁAԂł̓q[v̊mۂNȂ
+	// 蓖Ăvf̃AhX͉܂ŕςȂ
+	// XbhZ[tł͂Ȃ
+	template<typename T, uint32 PageSize = 256>
+	class SlabPool
+	{
+		static_assert(PageSize > 0);
+		static_assert(alignof(T) <= alignof(std::max_align_t), "mallocŊmۂłACg𒴂Ă܂");
+
+	public:
+		SlabPool() = default;
+		SlabPool(const SlabPool&) = delete;
+		SlabPool& operator=(const SlabPool&) = delete;
+
+		~SlabPool()
+		{
+			assert(!_Size);
+			for (Slot* const page : _Pages)
+			{
+				free(page);
+			}
+		}
+
+		template<class... Args>
+		[[nodiscard]] T* New(Args&&... args)
+		{
+			if (!_NextFree)
+			{
+				AddPage();
+			}
+			assert(_NextFree);
+
+			Slot* const slot{ _NextFree };
+			_NextFree = slot->Next;
+			_Size++;
+			return new (slot->Data) T(std::forward<Args>(args)...);
+		}
+
+		void Delete(T* const item)
+		{
+			assert(item && _Size);
+			item->~T();
+
+			Slot* const slot{ reinterpret_cast<Slot*>(item) };
+			slot->Next = _NextFree;
+			_NextFree = slot;
+			_Size--;
+		}
+
+		// ȂƂcapacityǉ̊mۂȂŊ蓖Ă悤ɂ
+		void Reserve(uint32 capacity)
+		{
+			while (_Pages.size() * PageSize < capacity)
+			{
+				AddPage();
+			}
+		}
+
+		[[nodiscard]] constexpr uint32 Size() const
+		{
+			return _Size;
+		}
+
+		[[nodiscard]] constexpr uint32 Capacity() const
+		{
+			return (uint32)_Pages.size() * PageSize;
+		}
+
+	private:
+		union Slot
+		{
+			Slot* Next; // 󂢂Ăꍇ͎̋
+			alignas(T) uint8 Data[sizeof(T)];
+		};
+
+		Vector<Slot*> _Pages;
+		Slot* _NextFree = nullptr;
+		uint32 _Size = 0;
+
+		void AddPage()
+		{
+			Slot* const page{ static_cast<Slot*>(malloc(sizeof(Slot) * PageSize)) };
+			assert(page);
+			_Pages.emplace_back(page);
+
+			// y[W̐擪珇Ɋ蓖Ă悤Ɍ납󂫃XgɌq
+			for (uint32 i = PageSize; i > 0; i--)
+			{
+				page[i - 1].Next = _NextFree;
+				_NextFree = &page[i - 1];
+			}
+		}
+	};
+}
\ No newline at end of file
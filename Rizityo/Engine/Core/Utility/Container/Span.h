@@ -0,0 +1,60 @@
+#pragma once
+#include "CommonHeaders.h"
+
+namespace Rizityo
+{
+	// Avfւ̎Q(L͂Ȃ)
+	template<typename T>
+	class Span
+	{
+	public:
+		constexpr Span() = default;
+
+		constexpr Span(T* const data, uint64 size) : _Data{ data }, _Size{ size }
+		{
+			assert(data || !size);
+		}
+
+		[[nodiscard]] constexpr T* data() const
+		{
+			return _Data;
+		}
+
+		[[nodiscard]] constexpr bool empty() const
+		{
+			return _Size == 0;
+		}
+
+		[[nodiscard]] constexpr uint64 size() const
+		{
+			return _Size;
+		}
+
+		[[nodiscard]] constexpr T& operator[](uint64 index) const
+		{
+			assert(_Data && index < _Size);
+			return _Data[index];
+		}
+
+		[[nodiscard]] constexpr T* begin() const
+		{
+			return _Data;
+		}
+
+		[[nodiscard]] constexpr T* end() const
+		{
+			return _Data + _Size;
+		}
+
+		// [offset, offset + count)̕Ԃ
+		[[nodiscard]] constexpr Span subspan(uint64 offset, uint64 count) const
+		{
+			assert(offset <= _Size && count <= _Size - offset);
+			return Span{ _Data + offset, count };
+		}
+
+	private:
+		T* _Data = nullptr;
+		uint64 _Size = 0;
+	};
+}
\ No newline at end of file
@@ -1,14 +1,24 @@
 #pragma once
 #include "CommonHeaders.h"
+#include "Allocator.h"
 
 namespace Rizityo
 {
-	template<typename T, bool Destruct = true>
-	class Vector
+	// Allocator͗vfůmہE(Allocator.hQ)
+	// ̌^ȂTCY͑Ȃ悤ɊNXƂĎ
+	template<typename T, bool Destruct = true, typename Allocator = MallocAllocator>
+	class Vector : private Allocator
 	{
 	public:
 		Vector() = default;
 
+		constexpr explicit Vector(const Allocator& allocator) : Allocator{ allocator } {}
+
+		constexpr Vector(uint64 size, const Allocator& allocator) : Allocator{ allocator }
+		{
+			resize(size);
+		}
+
 		constexpr Vector(uint64 size)
 		{
 			resize(size);
@@ -25,12 +35,12 @@ namespace Rizityo
 			Destroy();
 		}
 
-		constexpr Vector(const Vector& other)
+		constexpr Vector(const Vector& other) : Allocator{ other.GetAllocator() }
 		{
 			*this = other;
 		}
 
-		constexpr Vector(Vector&& other) : _Capacity{ other._Capacity }, _Size{ other._Size }, _Data{ other._Data }
+		constexpr Vector(Vector&& other) : Allocator{ other.GetAllocator() }, _Size{ other._Size }, _Capacity{ other._Capacity }, _Data{ other._Data }
 		{
 			other.Reset();
 		}
@@ -105,7 +115,8 @@ namespace Rizityo
 			_Size--;
 			if (item < std::addressof(_Data[_Size]))
 			{
-				memcpy(item, item + 1, (std::addressof(_Data[_Size]) - item) * sizeof(T));
+				// dȂ͈͂l߂̂memmove
+				memmove(item, item + 1, (std::addressof(_Data[_Size]) - item) * sizeof(T));
 			}
 
 			return item;
@@ -194,8 +205,8 @@ namespace Rizityo
 		{
 			if (newCapacity > _Capacity)
 			{
-				// realloc()͐V̈悪mۂꂽꍇɎŌ̃f[^Rs[
-				void* newBuffer = realloc(_Data, newCapacity * sizeof(T));
+				// V̈悪mۂꂽꍇ͌̃f[^Rs[
+				void* newBuffer = GetAllocator().Reallocate(_Data, _Capacity * sizeof(T), newCapacity * sizeof(T), alignof(T));
 				assert(newBuffer);
 				if (newBuffer)
 				{
@@ -215,6 +226,11 @@ namespace Rizityo
 			}
 		}
 
+		[[nodiscard]] constexpr const Allocator& GetAllocator() const
+		{
+			return *this;
+		}
+
 		[[nodiscard]] constexpr T* data()
 		{
 			return _Data;
@@ -303,6 +319,11 @@ namespace Rizityo
 		uint64 _Capacity = 0;
 		T* _Data = nullptr;
 
+		[[nodiscard]] constexpr Allocator& GetAllocator()
+		{
+			return *this;
+		}
+
 		constexpr void Reset()
 		{
 			_Capacity = 0;
@@ -310,8 +331,10 @@ namespace Rizityo
 			_Data = nullptr;
 		}
 
+		// mۂAP[^[ŉ̂ŃAP[^[ꏏɈڂ
 		constexpr void Move(Vector& other)
 		{
+			GetAllocator() = other.GetAllocator();
 			_Capacity = other._Capacity;
 			_Size = other._Size;
 			_Data = other._Data;
@@ -322,9 +345,9 @@ namespace Rizityo
 		{
 			assert([&] {return _Capacity ? _Data != nullptr : _Data == nullptr; }());
 			clear();
-			_Capacity = 0;
 			if (_Data)
-				free(_Data);
+				GetAllocator().Deallocate(_Data, _Capacity * sizeof(T));
+			_Capacity = 0;
 			_Data = nullptr;
 		}
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "CommonHeaders.h"
+#include <nmmintrin.h>
 
 namespace Rizityo::Math
 {
@@ -0,0 +1,137 @@
+#include "Random.h"
+#include "SIMD.h"
+#include <cmath>
+
+namespace Rizityo::Math
+{
+	namespace
+	{
+		constexpr uint32 PhiloxM0 = 0xD2511F53;
+		constexpr uint32 PhiloxM1 = 0xCD9E8D57;
+		constexpr uint32 PhiloxW0 = 0x9E3779B9; // 
+		constexpr uint32 PhiloxW1 = 0xBB67AE85; // sqrt(3) - 1
+		constexpr uint32 PhiloxRounds = 10;
+
+		// 24bitg[0, 1)ɕϊ(float̉Ɏ܂̂Ō덷Ȃϊł)
+		constexpr float32 ToUnitScale = 1.f / 16777216.f;
+
+		// AVX2łƓlɂȂ悤Ɋۂ߂1FMA[min, max)ɕϊ
+		// (ZƉZʁXɏƃRpCFMAɂ܂Ƃ߂邩ǂŌʂς)
+		float32 ToRange(uint32 bits, float32 min, float32 max)
+		{
+			return std::fma((float32)(bits >> 8), (max - min) * ToUnitScale, min);
+		}
+
+		void PhiloxRound(uint32 (&counter)[4], uint32 key0, uint32 key1)
+		{
+			const uint64 product0 = (uint64)PhiloxM0 * counter[0];
+			const uint64 product1 = (uint64)PhiloxM1 * counter[2];
+			const uint32 hi0 = (uint32)(product0 >> 32), lo0 = (uint32)product0;
+			const uint32 hi1 = (uint32)(product1 >> 32), lo1 = (uint32)product1;
+			counter[0] = hi1 ^ counter[1] ^ key0;
+			counter[1] = lo1;
+			counter[2] = hi0 ^ counter[3] ^ key1;
+			counter[3] = lo0;
+		}
+
+#if USE_AVX2
+		// 8[32bitm̐ς̏ʂƉ
+		AVX2_FUNCTION void MulHiLo(__m256i a, __m256i m, OUT __m256i& hi, OUT __m256i& lo)
+		{
+			const __m256i even = _mm256_mul_epu32(a, m);
+			const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+			lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
+			hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010);
+		}
+
+		// 8̃CfbNX̗(Generatěʂ0Ԗ)܂Ƃ߂Đ
+		AVX2_FUNCTION __m256i Philox8(__m256i c0, __m256i c1, __m256i c2, __m256i c3, uint32 key0, uint32 key1)
+		{
+			const __m256i m0 = _mm256_set1_epi32((int32)PhiloxM0);
+			const __m256i m1 = _mm256_set1_epi32((int32)PhiloxM1);
+			for (uint32 round = 0; round < PhiloxRounds; round++)
+			{
+				__m256i hi0, lo0, hi1, lo1;
+				MulHiLo(c0, m0, hi0, lo0);
+				MulHiLo(c2, m1, hi1, lo1);
+				c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32((int32)key0));
+				c1 = lo1;
+				c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32((int32)key1));
+				c3 = lo0;
+				key0 += PhiloxW0;
+				key1 += PhiloxW1;
+			}
+			return c0;
+		}
+
+		AVX2_FUNCTION void FillUniformAVX2(uint32 key0, uint32 key1, uint32 firstIndex, uint32 count, uint32 frame, uint32 dimension,
+										   float32 min, float32 max, OUT float32* const out)
+		{
+			const __m256i c1 = _mm256_set1_epi32((int32)frame);
+			const __m256i c2 = _mm256_set1_epi32((int32)dimension);
+			const __m256i c3 = _mm256_setzero_si256();
+			const __m256i step = _mm256_set1_epi32(8);
+			const __m256 scale = _mm256_set1_ps((max - min) * ToUnitScale);
+			const __m256 offset = _mm256_set1_ps(min);
+			__m256i index = _mm256_add_epi32(_mm256_set1_epi32((int32)firstIndex), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+			for (uint32 i = 0; i + 8 <= count; i += 8, index = _mm256_add_epi32(index, step))
+			{
+				const __m256i bits = Philox8(index, c1, c2, c3, key0, key1);
+				const __m256 unit = _mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8));
+				_mm256_storeu_ps(out + i, _mm256_fmadd_ps(unit, scale, offset));
+			}
+		}
+#endif // USE_AVX2
+	}
+
+	void CounterRNG::Generate(uint32 index, uint32 frame, uint32 dimension, OUT uint32 (&result)[4]) const
+	{
+		result[0] = index;
+		result[1] = frame;
+		result[2] = dimension;
+		result[3] = 0;
+
+		uint32 key0 = _Key0, key1 = _Key1;
+		for (uint32 round = 0; round < PhiloxRounds; round++)
+		{
+			PhiloxRound(result, key0, key1);
+			key0 += PhiloxW0;
+			key1 += PhiloxW1;
+		}
+	}
+
+	float32 CounterRNG::Uniform(uint32 index, uint32 frame, uint32 dimension) const
+	{
+		uint32 bits[4];
+		Generate(index, frame, dimension, bits);
+		return (float32)(bits[0] >> 8) * ToUnitScale;
+	}
+
+	float32 CounterRNG::Uniform(uint32 index, uint32 frame, uint32 dimension, float32 min, float32 max) const
+	{
+		uint32 bits[4];
+		Generate(index, frame, dimension, bits);
+		return ToRange(bits[0], min, max);
+	}
+
+	void CounterRNG::FillUniform(uint32 firstIndex, uint32 count, uint32 frame, uint32 dimension, float32 min, float32 max, OUT float32* const out) const
+	{
+		assert(out || !count);
+
+		uint32 i = 0;
+#if USE_AVX2
+		if (Math::SIMD::IsAVX2Supported())
+		{
+			FillUniformAVX2(_Key0, _Key1, firstIndex, count, frame, dimension, min, max, out);
+			i = count & ~7u;
+		}
+#endif
+		for (; i < count; i++)
+		{
+			uint32 bits[4];
+			Generate(firstIndex + i, frame, dimension, bits);
+			out[i] = ToRange(bits[0], min, max);
+		}
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "CommonHeaders.h"
+
+namespace Rizityo::Math
+{
+	// JE^[x[X̗(Philox4x32-10)
+	// ԂA(V[h, CfbNX, t[, )猈܂Ԃ̂
+	// ǂ̃Xbhǂ̏ԂŌĂłʂɂȂ
+	class CounterRNG
+	{
+	public:
+
+		constexpr CounterRNG() = default;
+		constexpr explicit CounterRNG(uint64 seed) : _Key0{ (uint32)seed }, _Key1{ (uint32)(seed >> 32) } {}
+
+		// 432bit𐶐
+		// index: GeBeBȂǂ̔ԍ, frame: t[ԍ, dimension: t[ŕ̗Kvȏꍇ̔ԍ
+		void Generate(uint32 index, uint32 frame, uint32 dimension, OUT uint32 (&result)[4]) const;
+
+		// [0, 1)̈l
+		[[nodiscard]] float32 Uniform(uint32 index, uint32 frame, uint32 dimension = 0) const;
+
+		// [min, max)̈l
+		[[nodiscard]] float32 Uniform(uint32 index, uint32 frame, uint32 dimension, float32 min, float32 max) const;
+
+		// CfbNX[firstIndex, firstIndex + count)[min, max)̈l܂Ƃ߂outɏ
+		// ʂ1UniformĂ񂾏ꍇƓ(AVX2gꍇ8܂Ƃ߂Đ)
+		void FillUniform(uint32 firstIndex, uint32 count, uint32 frame, uint32 dimension, float32 min, float32 max, OUT float32* const out) const;
+
+		[[nodiscard]] constexpr uint64 Seed() const { return ((uint64)_Key1 << 32) | _Key0; }
+
+	private:
+
+		uint32 _Key0 = 0;
+		uint32 _Key1 = 0;
+	};
+}
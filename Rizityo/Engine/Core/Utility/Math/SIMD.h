@@ -0,0 +1,70 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// AVX2̃R[hpXgǂ(0ɂƃXJ[łg)
+#define USE_AVX2 1
+
+// MSVC/archwȂAVX2̑gݍ݊֐g邪AGCC/Clang͊֐ƂɃ^[Qbgw肷
+#if defined(_MSC_VER)
+#define AVX2_FUNCTION
+#else
+#define AVX2_FUNCTION __attribute__((target("avx2,fma")))
+#endif
+
+namespace Rizityo::Math::SIMD
+{
+	// sCPUOSAVX2FMAg邩ǂ(ʂ̓LbV)
+	[[nodiscard]] inline bool IsAVX2Supported()
+	{
+#if USE_AVX2
+		static const bool supported = []
+		{
+#if defined(_MSC_VER)
+			int32 info[4]{};
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			__cpuid(info, 1);
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool fma = (info[2] & (1 << 12)) != 0;
+			if (!osxsave || !fma)
+				return false;
+
+			// OSYMMWX^ޔ邩ǂ
+			if ((_xgetbv(0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+		}();
+		return supported;
+#else
+		return false;
+#endif // USE_AVX2
+	}
+
+#if USE_AVX2
+	// 8vf̍v
+	[[nodiscard]] AVX2_FUNCTION inline float32 HorizontalSum(__m256 v)
+	{
+		__m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+		__m128 shuf = _mm_movehdup_ps(s);
+		s = _mm_add_ps(s, shuf);
+		shuf = _mm_movehl_ps(shuf, s);
+		s = _mm_add_ss(s, shuf);
+		return _mm_cvtss_f32(s);
+	}
+#endif // USE_AVX2
+}
@@ -0,0 +1,88 @@
+#include "SpatialHash.h"
+
+namespace Rizityo::Spatial
+{
+	template<typename GetPosition>
+	void SpatialHash::BuildImpl(uint32 count, float32 cellSize, GetPosition getPosition)
+	{
+		assert(cellSize > 0.f);
+
+		_CellSize = cellSize;
+		_InvCellSize = 1.f / cellSize;
+		_Count = count;
+
+		// oPbg͓_̐2{ȏ2ׂ̂ɂďՓ˂炷
+		uint32 bucketCount = 64;
+		while (bucketCount < count * 2)
+		{
+			bucketCount <<= 1;
+		}
+		_BucketMask = bucketCount - 1;
+
+		_CellStart.resize(bucketCount + 1);
+		memset(_CellStart.data(), 0, _CellStart.size() * sizeof(uint32));
+		_SortedIndices.resize(count);
+		_PointBuckets.resize(count);
+		_SortedX.resize(count);
+		_SortedY.resize(count);
+		_SortedZ.resize(count);
+
+		// oPbgƂ̓_̐𐔂
+		for (uint32 i = 0; i < count; i++)
+		{
+			float32 x, y, z;
+			getPosition(i, x, y, z);
+			const uint32 bucket = HashCell(CellCoord(x), CellCoord(y), CellCoord(z));
+			_PointBuckets[i] = bucket;
+			_CellStart[bucket + 1]++;
+		}
+
+		// ݐϘaŊeoPbg̊Jnʒu߂
+		for (uint32 i = 0; i < bucketCount; i++)
+		{
+			_CellStart[i + 1] += _CellStart[i];
+		}
+		assert(_CellStart[bucketCount] == count);
+
+		// v\[gŃoPbgɕׂ(_CellStart݈ʒuƂĎgĂ߂)
+		for (uint32 i = 0; i < count; i++)
+		{
+			const uint32 dst = _CellStart[_PointBuckets[i]]++;
+			_SortedIndices[dst] = i;
+			getPosition(i, _SortedX[dst], _SortedY[dst], _SortedZ[dst]);
+		}
+
+		for (uint32 i = bucketCount; i > 0; i--)
+		{
+			_CellStart[i] = _CellStart[i - 1];
+		}
+		_CellStart[0] = 0;
+	}
+
+	void SpatialHash::Build(const float32* const positions, uint32 stride, uint32 count, float32 cellSize)
+	{
+		assert(positions || !count);
+		assert(stride >= sizeof(float32) * 3);
+
+		const uint8* const data = reinterpret_cast<const uint8*>(positions);
+		BuildImpl(count, cellSize, [data, stride](uint32 i, float32& x, float32& y, float32& z)
+		{
+			const float32* const pos = reinterpret_cast<const float32*>(data + (uint64)i * stride);
+			x = pos[0];
+			y = pos[1];
+			z = pos[2];
+		});
+	}
+
+	void SpatialHash::Build(const float32* const xs, const float32* const ys, const float32* const zs, uint32 count, float32 cellSize)
+	{
+		assert((xs && ys && zs) || !count);
+
+		BuildImpl(count, cellSize, [xs, ys, zs](uint32 i, float32& x, float32& y, float32& z)
+		{
+			x = xs[i];
+			y = ys[i];
+			z = zs[i];
+		});
+	}
+}
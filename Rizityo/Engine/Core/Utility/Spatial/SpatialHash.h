@@ -0,0 +1,186 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <cmath>
+#include <algorithm>
+
+namespace Rizityo::Spatial
+{
+	// ߖTT̓v(x`}[Np)
+	struct QueryStats
+	{
+		uint64 QueryCount = 0; // ߖT𒲂ׂ_̐
+		uint64 CandidateCount = 0; // ׂZɓĂ̐
+		uint64 NeighborCount = 0; // ۂɋߖTƂ݂Ȃ
+
+		QueryStats& operator+=(const QueryStats& other)
+		{
+			QueryCount += other.QueryCount;
+			CandidateCount += other.CandidateCount;
+			NeighborCount += other.NeighborCount;
+			return *this;
+		}
+	};
+
+	// NGׂZ͈̔(e[Min, Max])
+	// ͈͂ɂȂNG͓𒲂ׂ̂ŁAW߂̂g܂킹
+	struct CellRange
+	{
+		int32 MinX, MinY, MinZ;
+		int32 MaxX, MaxY, MaxZ;
+
+		[[nodiscard]] constexpr bool operator==(const CellRange& other) const
+		{
+			return MinX == other.MinX && MinY == other.MinY && MinZ == other.MinZ &&
+				MaxX == other.MaxX && MaxY == other.MaxY && MaxZ == other.MaxZ;
+		}
+		[[nodiscard]] constexpr bool operator!=(const CellRange& other) const { return !(*this == other); }
+	};
+
+	// lObhɂԃnbV
+	// t[ʒuz񂩂蒼ĔaNGɓ
+	// : NGa̓ZTCYȉł邱(ߖT3x3x3Z𒲂ׂ)
+	class SpatialHash
+	{
+	public:
+
+		SpatialHash() = default;
+		DISABLE_COPY_AND_MOVE(SpatialHash);
+
+		// positionsstrideoCgƂx, y, złz
+		void Build(const float32* const positions, uint32 stride, uint32 count, float32 cellSize);
+
+		// WƂ̔z(SoA)œnꍇ
+		void Build(const float32* const xs, const float32* const ys, const float32* const zs, uint32 count, float32 cellSize);
+
+		// _(x, y, z)甼aradius̃NGׂZ͈̔
+		[[nodiscard]] CellRange GetCellRange(float32 x, float32 y, float32 z, float32 radius) const
+		{
+			assert(radius <= _CellSize);
+			// ۂߌ덷4Zɂ܂Ȃ悤Ɋe3Z܂łɐ
+			CellRange range{};
+			range.MinX = CellCoord(x - radius);
+			range.MinY = CellCoord(y - radius);
+			range.MinZ = CellCoord(z - radius);
+			range.MaxX = std::min(CellCoord(x + radius), range.MinX + 2);
+			range.MaxY = std::min(CellCoord(y + radius), range.MinY + 2);
+			range.MaxZ = std::min(CellCoord(z + radius), range.MinZ + 2);
+			return range;
+		}
+
+		// ǎ₪ĂoPbgƂɁA\[gςݔz͈̔[begin, end)func(begin, end)ɓn
+		// ͈͓ɂ͔aO̓_܂܂̂ŋ̔͌Ăяoōs
+		template<typename Func>
+		void ForEachCell(float32 x, float32 y, float32 z, float32 radius, Func&& func) const
+		{
+			ForEachCell(GetCellRange(x, y, z, radius), std::forward<Func>(func));
+		}
+
+		// rangẽZĂoPbgƂɁA\[gςݔz͈̔[begin, end)func(begin, end)ɓn
+		template<typename Func>
+		void ForEachCell(const CellRange& range, Func&& func) const
+		{
+			if (!_Count)
+				return;
+
+			const int32 minX = range.MinX, maxX = range.MaxX;
+			const int32 minY = range.MinY, maxY = range.MaxY;
+			const int32 minZ = range.MinZ, maxZ = range.MaxZ;
+
+			// قȂZoPbgɓ邱Ƃ̂ŒׂoPbgoĂ
+			// ̃oPbg͉xׂĂnȂ̂ŁAłȂoPbgoΏ\
+			constexpr uint32 MaxVisited = 27;
+			uint32 visited[MaxVisited];
+			uint32 visitedCount = 0;
+
+			for (int32 cx = minX; cx <= maxX; cx++)
+			{
+				for (int32 cy = minY; cy <= maxY; cy++)
+				{
+					for (int32 cz = minZ; cz <= maxZ; cz++)
+					{
+						const uint32 bucket = HashCell(cx, cy, cz);
+						const uint32 begin = _CellStart[bucket];
+						const uint32 end = _CellStart[bucket + 1];
+						if (begin == end)
+							continue;
+
+						bool alreadyVisited = false;
+						for (uint32 i = 0; i < visitedCount; i++)
+						{
+							if (visited[i] == bucket)
+							{
+								alreadyVisited = true;
+								break;
+							}
+						}
+						if (alreadyVisited)
+							continue;
+
+						assert(visitedCount < MaxVisited);
+						visited[visitedCount++] = bucket;
+						func(begin, end);
+					}
+				}
+			}
+		}
+
+		// aɂ_̃CfbNXƋ2func(index, distSquare)ɓn
+		// g܂܂̂ŌĂяoŏO
+		template<typename Func>
+		void ForEachNeighbor(float32 x, float32 y, float32 z, float32 radius, Func&& func) const
+		{
+			const float32 radiusSquare = radius * radius;
+			ForEachCell(x, y, z, radius, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; i++)
+				{
+					const float32 dx = _SortedX[i] - x;
+					const float32 dy = _SortedY[i] - y;
+					const float32 dz = _SortedZ[i] - z;
+					const float32 distSquare = dx * dx + dy * dy + dz * dz;
+					if (distSquare <= radiusSquare)
+					{
+						func(_SortedIndices[i], distSquare);
+					}
+				}
+			});
+		}
+
+		[[nodiscard]] constexpr uint32 Count() const { return _Count; }
+		[[nodiscard]] constexpr float32 CellSize() const { return _CellSize; }
+
+		// oPbgɕׂf[^(ForEachCell͈̔͂͂̔z̃CfbNX)
+		[[nodiscard]] const uint32* const SortedIndices() const { return _SortedIndices.data(); }
+		[[nodiscard]] const float32* const SortedX() const { return _SortedX.data(); }
+		[[nodiscard]] const float32* const SortedY() const { return _SortedY.data(); }
+		[[nodiscard]] const float32* const SortedZ() const { return _SortedZ.data(); }
+
+	private:
+
+		Vector<uint32> _CellStart; // oPbg -> _SortedIndices̊Jnʒu (TCY̓oPbg + 1)
+		Vector<uint32> _SortedIndices; // oPbgɕׂ_̃CfbNX
+		Vector<uint32> _PointBuckets; // _̃CfbNX -> oPbg
+		// oPbgɕׂW(NG̃LbV~X炷)
+		Vector<float32> _SortedX;
+		Vector<float32> _SortedY;
+		Vector<float32> _SortedZ;
+		float32 _CellSize = 1.f;
+		float32 _InvCellSize = 1.f;
+		uint32 _BucketMask = 0;
+		uint32 _Count = 0;
+
+		template<typename GetPosition>
+		void BuildImpl(uint32 count, float32 cellSize, GetPosition getPosition);
+
+		[[nodiscard]] int32 CellCoord(float32 v) const
+		{
+			return static_cast<int32>(floorf(v * _InvCellSize));
+		}
+
+		[[nodiscard]] uint32 HashCell(int32 cx, int32 cy, int32 cz) const
+		{
+			const uint32 h = ((uint32)cx * 73856093u) ^ ((uint32)cy * 19349663u) ^ ((uint32)cz * 83492791u);
+			return h & _BucketMask;
+		}
+	};
+}
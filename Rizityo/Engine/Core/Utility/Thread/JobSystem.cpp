@@ -0,0 +1,447 @@
+#include "JobSystem.h"
+#include <thread>
+#include <condition_variable>
+#include <memory>
+#include <algorithm>
+
+namespace Rizityo::Thread
+{
+	namespace Internal
+	{
+		struct JobCounterAccess
+		{
+			static void Increment(JobCounter& counter)
+			{
+				counter._Count.fetch_add(1);
+			}
+
+			// 炵0ɂȂꍇtrueԂA㑱̃WucontinuationsɈڂ
+			static bool Decrement(JobCounter& counter, OUT Vector<Job>& continuations)
+			{
+				counter._Decrementing.fetch_add(1);
+				const bool done = counter._Count.fetch_sub(1) == 1;
+				if (done)
+				{
+					std::lock_guard lock{ counter._Mutex };
+					continuations.swap(counter._Continuations);
+				}
+				// ȍ~counter͔jĂ\
+				counter._Decrementing.fetch_sub(1);
+				return done;
+			}
+
+			// counter0łȂΌ㑱̃WuƂēo^(o^łȂfalse)
+			static bool AddContinuation(JobCounter& counter, const Job& job)
+			{
+				std::lock_guard lock{ counter._Mutex };
+				if (counter._Count.load() == 0)
+					return false;
+
+				counter._Continuations.emplace_back(job);
+				return true;
+			}
+		};
+	}
+
+	namespace JobSystem
+	{
+		namespace
+		{
+			using Job = Thread::Internal::Job;
+			using CounterAccess = Thread::Internal::JobCounterAccess;
+
+			// false sharing邽߂ɃLbVCƂɕ
+			struct alignas(64) WorkQueue
+			{
+				std::mutex Mutex;
+				Deque<Job> Jobs;
+				std::atomic<uint32> Size{ 0 }; // bNɋ󂩂ǂ𒲂ׂ邽
+			};
+
+			struct ParallelForContext
+			{
+				Job::Function Func;
+				void* Context;
+				uint32 Count;
+				uint32 ChunkSize;
+				JobCounter* Counter;
+			};
+
+			constexpr uint32 MainThreadIndex = 0;
+
+			std::unique_ptr<WorkQueue[]> Queues; // [0]̓CXbhA[1, WorkerCount]̓[J[
+			uint32 QueueCount = 0;
+			WorkQueue MainThreadQueue; // CXbhłsȂWu
+			Vector<std::thread> Workers;
+			bool Initialized = false;
+
+			std::atomic<uint32> PendingJobs{ 0 }; // QueuesɓĂWu̐
+			std::atomic<uint32> SleepingThreads{ 0 }; // WakeConditionő҂ĂXbh̐
+			std::atomic<uint32> NextQueue{ 0 }; // WuVXeÕXbh甭sꍇ̐U蕪
+			std::mutex SleepMutex;
+			std::condition_variable WakeCondition;
+			bool Quit = false; // SleepMutexŕی
+
+			thread_local uint32 ThreadIndex = UINT32_INVALID_NUM;
+
+			// ҂ĂXbh΋N
+			// ҂SleepingThreads𑝂₵Ă𒲂ׂ̂ŁAςĂ琔𒲂ׂΎ肱ڂȂ
+			void WakeThreads(bool all)
+			{
+				if (SleepingThreads.load() == 0)
+					return;
+
+				std::lock_guard lock{ SleepMutex };
+				if (all)
+				{
+					WakeCondition.notify_all();
+				}
+				else
+				{
+					WakeCondition.notify_one();
+				}
+			}
+
+			void Push(const Job& job)
+			{
+				if (job.MainThread)
+				{
+					{
+						std::lock_guard lock{ MainThreadQueue.Mutex };
+						MainThreadQueue.Jobs.push_back(job);
+						MainThreadQueue.Size.fetch_add(1);
+					}
+					// [J[NĂoȂ̂ŁACXbhɓ͂悤ɑSN
+					WakeThreads(true);
+					return;
+				}
+
+				// [J[ƃCXbh͎̃L[ɐς
+				const uint32 index = ThreadIndex < QueueCount ? ThreadIndex : NextQueue.fetch_add(1) % QueueCount;
+				WorkQueue& queue{ Queues[index] };
+				// oɌ炳Ȃ悤ɁAςޑOɑ₷
+				PendingJobs.fetch_add(1);
+				{
+					std::lock_guard lock{ queue.Mutex };
+					queue.Jobs.push_back(job);
+					queue.Size.fetch_add(1);
+				}
+				WakeThreads(false);
+			}
+
+			bool PopBack(WorkQueue& queue, OUT Job& job)
+			{
+				if (!queue.Size.load(std::memory_order_relaxed))
+					return false;
+
+				std::lock_guard lock{ queue.Mutex };
+				if (queue.Jobs.empty())
+					return false;
+
+				job = queue.Jobs.back();
+				queue.Jobs.pop_back();
+				queue.Size.fetch_sub(1);
+				return true;
+			}
+
+			bool PopFront(WorkQueue& queue, OUT Job& job)
+			{
+				if (!queue.Size.load(std::memory_order_relaxed))
+					return false;
+
+				std::lock_guard lock{ queue.Mutex };
+				if (queue.Jobs.empty())
+					return false;
+
+				job = queue.Jobs.front();
+				queue.Jobs.pop_front();
+				queue.Size.fetch_sub(1);
+				return true;
+			}
+
+			bool TryGetJob(OUT Job& job)
+			{
+				const uint32 index = ThreadIndex;
+				if (index == MainThreadIndex && PopFront(MainThreadQueue, job))
+					return true;
+
+				// ̃L[璼Oɐς񂾂̂o(LbVɎcĂ\)
+				if (index < QueueCount && PopBack(Queues[index], job))
+				{
+					PendingJobs.fetch_sub(1);
+					return true;
+				}
+
+				// ̃L[Â(Ȏ傫ȃWu)𓐂
+				const uint32 start = index < QueueCount ? index + 1 : 0;
+				for (uint32 i = 0; i < QueueCount; i++)
+				{
+					const uint32 victim = (start + i) % QueueCount;
+					if (victim != index && PopFront(Queues[victim], job))
+					{
+						PendingJobs.fetch_sub(1);
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			void Submit(const Job& job, JobCounter* const dependency)
+			{
+				if (!Initialized)
+				{
+					// O͈ˑIɏIĂ̂ł̏Ŏs
+					assert(!dependency || dependency->IsDone());
+					Vector<Job> continuations;
+					job.Func(job.Context, job.Begin, job.End);
+					if (job.Counter)
+					{
+						CounterAccess::Decrement(*job.Counter, continuations);
+					}
+					assert(continuations.empty());
+					return;
+				}
+
+				if (dependency && CounterAccess::AddContinuation(*dependency, job))
+					return;
+
+				Push(job);
+			}
+
+			void Execute(const Job& job)
+			{
+				job.Func(job.Context, job.Begin, job.End);
+
+				Vector<Job> continuations;
+				if (job.Counter && CounterAccess::Decrement(*job.Counter, continuations))
+				{
+					for (const Job& continuation : continuations)
+					{
+						Push(continuation);
+					}
+					// Waitő҂ĂXbhɒm点
+					WakeThreads(true);
+				}
+			}
+
+			void WorkerLoop(uint32 index)
+			{
+				ThreadIndex = index;
+				while (true)
+				{
+					Job job;
+					if (TryGetJob(job))
+					{
+						Execute(job);
+						continue;
+					}
+
+					std::unique_lock lock{ SleepMutex };
+					SleepingThreads.fetch_add(1);
+					WakeCondition.wait(lock, [] { return Quit || PendingJobs.load() > 0; });
+					SleepingThreads.fetch_sub(1);
+					if (Quit)
+						return;
+				}
+			}
+
+			void RunTask(void* context, uint32, uint32)
+			{
+				std::unique_ptr<Task> task{ static_cast<Task*>(context) };
+				(*task)();
+			}
+
+			void RunTask(Task&& task, JobCounter* const counter, JobCounter* const dependency, bool mainThread)
+			{
+				assert(task);
+				Job job{};
+				job.Func = &RunTask;
+				job.Context = new Task{ std::move(task) };
+				job.Counter = counter;
+				job.MainThread = mainThread;
+				if (counter)
+				{
+					CounterAccess::Increment(*counter);
+				}
+				Submit(job, dependency);
+			}
+
+			// `N͈̔[begin, end)𔼕̃XbhɓnAŌɎc1`N
+			void SplitParallelFor(void* context, uint32 begin, uint32 end)
+			{
+				const ParallelForContext& data{ *static_cast<const ParallelForContext*>(context) };
+				while (end - begin > 1)
+				{
+					const uint32 middle = begin + (end - begin) / 2;
+					Job job{};
+					job.Func = &SplitParallelFor;
+					job.Context = context;
+					job.Begin = middle;
+					job.End = end;
+					job.Counter = data.Counter;
+					CounterAccess::Increment(*data.Counter);
+					Push(job);
+					end = middle;
+				}
+
+				const uint32 first = begin * data.ChunkSize;
+				data.Func(data.Context, first, std::min(first + data.ChunkSize, data.Count));
+			}
+		}
+
+		void Initialize(uint32 workerCount)
+		{
+			assert(!Initialized);
+
+			if (!workerCount)
+			{
+				const uint32 hardwareCount = std::thread::hardware_concurrency();
+				workerCount = hardwareCount > 2 ? hardwareCount - 1 : 1;
+			}
+
+			QueueCount = workerCount + 1;
+			Queues = std::make_unique<WorkQueue[]>(QueueCount);
+			ThreadIndex = MainThreadIndex;
+			Quit = false;
+			Initialized = true;
+
+			// std::thread̍ĔzuNȂ悤ɐɊmۂĂ
+			Workers.reserve(workerCount);
+			for (uint32 i = 0; i < workerCount; i++)
+			{
+				Workers.emplace_back([i] { WorkerLoop(i + 1); });
+			}
+		}
+
+		void Shutdown()
+		{
+			if (!Initialized)
+				return;
+
+			assert(ThreadIndex == MainThreadIndex);
+
+			// cĂWuЕtĂ~߂
+			ExecuteMainThreadJobs();
+			Job job;
+			while (TryGetJob(job))
+			{
+				Execute(job);
+			}
+
+			{
+				std::lock_guard lock{ SleepMutex };
+				Quit = true;
+			}
+			WakeCondition.notify_all();
+
+			for (auto& worker : Workers)
+			{
+				worker.join();
+			}
+			Workers.clear();
+
+			assert(!PendingJobs.load() && !MainThreadQueue.Size.load());
+			Queues.reset();
+			QueueCount = 0;
+			ThreadIndex = UINT32_INVALID_NUM;
+			Initialized = false;
+		}
+
+		bool IsInitialized()
+		{
+			return Initialized;
+		}
+
+		uint32 WorkerCount()
+		{
+			return (uint32)Workers.size();
+		}
+
+		void Run(Task task, JobCounter* const counter, JobCounter* const dependency)
+		{
+			RunTask(std::move(task), counter, dependency, false);
+		}
+
+		void RunOnMainThread(Task task, JobCounter* const counter, JobCounter* const dependency)
+		{
+			RunTask(std::move(task), counter, dependency, true);
+		}
+
+		void ExecuteMainThreadJobs()
+		{
+			assert(!Initialized || ThreadIndex == MainThreadIndex);
+
+			Job job;
+			while (PopFront(MainThreadQueue, job))
+			{
+				Execute(job);
+			}
+		}
+
+		void Wait(JobCounter* const counter)
+		{
+			assert(counter);
+			if (!Initialized)
+			{
+				assert(counter->IsDone());
+				return;
+			}
+
+			const bool mainThread = ThreadIndex == MainThreadIndex;
+			while (!counter->IsDone())
+			{
+				Job job;
+				if (TryGetJob(job))
+				{
+					Execute(job);
+					continue;
+				}
+
+				std::unique_lock lock{ SleepMutex };
+				SleepingThreads.fetch_add(1);
+				WakeCondition.wait(lock, [counter, mainThread]
+				{
+					return counter->IsDone() || PendingJobs.load() > 0 || (mainThread && MainThreadQueue.Size.load() > 0);
+				});
+				SleepingThreads.fetch_sub(1);
+			}
+		}
+
+		namespace Internal
+		{
+			void ParallelFor(uint32 count, uint32 chunkSize, Thread::Internal::Job::Function func, void* context)
+			{
+				assert(chunkSize > 0);
+				if (!count)
+					return;
+
+				const uint32 chunkCount = (count + chunkSize - 1) / chunkSize;
+
+				// [J[ȂA܂̓`N1̏ꍇ͂̃Xbhŏ
+				if (!Initialized || chunkCount == 1)
+				{
+					for (uint32 begin = 0; begin < count; begin += chunkSize)
+					{
+						func(context, begin, std::min(begin + chunkSize, count));
+					}
+					return;
+				}
+
+				JobCounter counter;
+				ParallelForContext data{ func, context, count, chunkSize, &counter };
+				Job job{};
+				job.Func = &SplitParallelFor;
+				job.Context = &data;
+				job.Begin = 0;
+				job.End = chunkCount;
+				job.Counter = &counter;
+				CounterAccess::Increment(counter);
+				Push(job);
+
+				// ĂяõXbhɎQ
+				Wait(&counter);
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <functional>
+#include <atomic>
+#include <mutex>
+
+namespace Rizityo::Thread
+{
+	class JobCounter;
+
+	namespace Internal
+	{
+		struct Job
+		{
+			using Function = void(*)(void* context, uint32 begin, uint32 end);
+
+			Function Func = nullptr;
+			void* Context = nullptr;
+			uint32 Begin = 0;
+			uint32 End = 0;
+			JobCounter* Counter = nullptr; // 猸炷JE^[
+			bool MainThread = false; // CXbhłsȂ
+		};
+
+		struct JobCounterAccess;
+	}
+
+	// IĂȂWu̐
+	// 0ɂȂƑ҂ĂXbhNÃJE^[ɈˑWu𔭍s
+	// Wu𔭍sĂ犮҂܂ŔjȂ
+	class JobCounter
+	{
+	public:
+
+		JobCounter() = default;
+		DISABLE_COPY_AND_MOVE(JobCounter);
+		~JobCounter() { assert(IsDone()); }
+
+		[[nodiscard]] bool IsDone() const
+		{
+			return _Count.load() == 0 && _Decrementing.load() == 0;
+		}
+
+	private:
+
+		friend struct Internal::JobCounterAccess;
+
+		std::atomic<uint32> _Count{ 0 };
+		std::atomic<uint32> _Decrementing{ 0 }; // 炵Ăr̃Xbh̐(0ɂȂ܂ŔjłȂ)
+		std::mutex _Mutex;
+		Vector<Internal::Job> _Continuations; // 0ɂȂ甭sWu(_Mutexŕی)
+	};
+}
+
+// [NXeB[O^̃WuVXe
+// XbhƂɃWũL[ÃL[͌납(LIFO)ÃXbh̃L[͑O(FIFO)o
+// InitializeĂ񂾃XbhCXbhƂ
+// ĂȂꍇAsWu͂̏Ŏs
+namespace Rizityo::Thread::JobSystem
+{
+	using Task = std::function<void()>;
+
+	// workerCount0̏ꍇ(_RA - 1)(Œ1)
+	void Initialize(uint32 workerCount = 0);
+	void Shutdown();
+	[[nodiscard]] bool IsInitialized();
+	[[nodiscard]] uint32 WorkerCount();
+
+	// task𔭍s
+	// counternƊ܂ŃJEgAdependencyndependency0ɂȂĂ甭s
+	void Run(Task task, JobCounter* const counter = nullptr, JobCounter* const dependency = nullptr);
+	// CXbhłsȂWu(ExecuteMainThreadJobsCXbhWaitŎs)
+	void RunOnMainThread(Task task, JobCounter* const counter = nullptr, JobCounter* const dependency = nullptr);
+	// CXbh疈t[ĂсA܂Ă郁CXbhp̃Wus
+	void ExecuteMainThreadJobs();
+
+	// counter0ɂȂ܂ő̃Wu`Ȃ҂
+	void Wait(JobCounter* const counter);
+
+	namespace Internal
+	{
+		void ParallelFor(uint32 count, uint32 chunkSize, Thread::Internal::Job::Function func, void* context);
+	}
+
+	// [0, count)chunkSizeƂɋ؂func(begin, end)ɌĂяoASďI܂ő҂
+	// ؂̓XbhɂȂ̂ŁA`NƂɏݐ𕪂Όʂ̓XbhɈˑȂ
+	template<typename Func>
+	void ParallelFor(uint32 count, uint32 chunkSize, Func&& func)
+	{
+		using FuncType = std::remove_reference_t<Func>;
+		Internal::ParallelFor(count, chunkSize, [](void* context, uint32 begin, uint32 end)
+		{
+			(*static_cast<FuncType*>(context))(begin, end);
+		}, const_cast<void*>(static_cast<const void*>(std::addressof(func))));
+	}
+}
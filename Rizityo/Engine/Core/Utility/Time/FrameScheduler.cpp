@@ -0,0 +1,91 @@
+#include "FrameScheduler.h"
+#include <thread>
+
+#ifdef _WIN64
+#include <Windows.h>
+#include <timeapi.h>
+#pragma comment(lib, "winmm.lib")
+#endif // _WIN64
+
+namespace Rizityo::Time
+{
+	namespace
+	{
+		// c肪ZȂX[vɑ҂(X[v͎w蒷Ȃ邱Ƃ邽)
+		constexpr std::chrono::microseconds SpinThreshold{ 2000 };
+
+	} // 萔
+
+	FrameScheduler::~FrameScheduler()
+	{
+#ifdef _WIN64
+		if (_HighResolutionTimer)
+		{
+			timeEndPeriod(1);
+		}
+#endif // _WIN64
+	}
+
+	void FrameScheduler::Reset(const FrameSchedulerInitInfo& info)
+	{
+		assert(info.FixedDeltaTime > 0.f && info.MaxStepsPerFrame > 0 && info.TargetFrameTime >= 0.f);
+		_Info = info;
+		_FixedStep = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float32>{ info.FixedDeltaTime });
+		_TargetFrameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float32>{ info.TargetFrameTime });
+		assert(_FixedStep.count() > 0);
+		_Accumulator = {};
+		_FrameStart = Clock::now();
+		_FrameDeltaTime = 0.f;
+		_InterpolationAlpha = 1.f;
+
+#ifdef _WIN64
+		// X[v̐x1msɂ
+		if (!_HighResolutionTimer)
+		{
+			_HighResolutionTimer = (timeBeginPeriod(1) == TIMERR_NOERROR);
+		}
+#endif // _WIN64
+	}
+
+	uint32 FrameScheduler::BeginFrame()
+	{
+		const Clock::time_point now{ Clock::now() };
+		const Clock::duration elapsed{ now - _FrameStart };
+		_FrameStart = now;
+		_FrameDeltaTime = std::chrono::duration<float32>{ elapsed }.count();
+
+		// ǂȂꍇɃXebvȂ悤ɏ݂
+		const Clock::duration maxAccumulator{ _FixedStep * _Info.MaxStepsPerFrame };
+		_Accumulator += elapsed;
+		if (_Accumulator > maxAccumulator)
+		{
+			_Accumulator = maxAccumulator;
+		}
+
+		const uint32 stepCount{ (uint32)(_Accumulator / _FixedStep) };
+		_Accumulator -= _FixedStep * stepCount;
+		_InterpolationAlpha = std::chrono::duration<float32>{ _Accumulator } / std::chrono::duration<float32>{ _FixedStep };
+		assert(_InterpolationAlpha >= 0.f && _InterpolationAlpha <= 1.f);
+
+		return stepCount;
+	}
+
+	void FrameScheduler::WaitForNextFrame() const
+	{
+		if (_TargetFrameTime.count() <= 0)
+			return;
+
+		const Clock::time_point target{ _FrameStart + _TargetFrameTime };
+		for (Clock::duration remaining{ target - Clock::now() }; remaining.count() > 0; remaining = target - Clock::now())
+		{
+			if (remaining > SpinThreshold)
+			{
+				std::this_thread::sleep_for(remaining - SpinThreshold);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+#include "CommonHeaders.h"
+#include <chrono>
+
+namespace Rizityo::Time
+{
+	struct FrameSchedulerInitInfo
+	{
+		float32 FixedDeltaTime = 1.f / 60.f; // 1Xebv̎(b)
+		uint32 MaxStepsPerFrame = 4; // 1t[ŎsXebv̏(̎Ԃ͎̂Ă)
+		float32 TargetFrameTime = 1.f / 60.f; // 1t[̍ŒZ(bA0Ȃ琧Ȃ)
+	};
+
+	// Œ莞ԃXebvŃV~[Vi߂邽߂̃t[̊Ǘ
+	// oߎԂ𒙂߂ĂFixedDeltaTimeXebvsAc̎Ԃ͕`̕ԂɎg
+	// V~[V̌ʂ͕`̃t[[gɈˑȂ
+	class FrameScheduler
+	{
+	public:
+
+		FrameScheduler() = default;
+		DISABLE_COPY_AND_MOVE(FrameScheduler);
+		~FrameScheduler();
+
+		void Reset(const FrameSchedulerInitInfo& info = {});
+
+		// t[̎n߂ɌĂсÃt[ŎsXebv̐Ԃ
+		[[nodiscard]] uint32 BeginFrame();
+		// `̌ɌĂсABeginFrameTargetFrameTimeo܂ő҂
+		void WaitForNextFrame() const;
+
+		[[nodiscard]] constexpr float32 FixedDeltaTime() const { return _Info.FixedDeltaTime; }
+		// Õt[̎ۂ̌oߎ(b)
+		[[nodiscard]] constexpr float32 FrameDeltaTime() const { return _FrameDeltaTime; }
+		// Ō̃Xebv玟̃Xebv܂ł̊(0~1A`̕ԂɎg)
+		[[nodiscard]] constexpr float32 InterpolationAlpha() const { return _InterpolationAlpha; }
+
+	private:
+
+		using Clock = std::chrono::steady_clock;
+
+		FrameSchedulerInitInfo _Info{};
+		Clock::duration _FixedStep{};
+		Clock::duration _TargetFrameTime{};
+		Clock::duration _Accumulator{}; // ܂XebvɎgĂȂ
+		Clock::time_point _FrameStart{};
+		float32 _FrameDeltaTime = 0.f;
+		float32 _InterpolationAlpha = 1.f;
+		bool _HighResolutionTimer = false;
+	};
+}
\ No newline at end of file
@@ -2,7 +2,10 @@
 
 
 #define USE_STL_VECTOR 0
-#define USE_STL_DEQUE 1
+#define USE_STL_DEQUE 0
+#define USE_STL_HASH_MAP 0
+
+#include "Container/Allocator.h"
 
 #if USE_STL_VECTOR
 #include <vector>
@@ -44,7 +47,40 @@ namespace Rizityo
 {
 	template<typename T>
 	using Deque = std::deque<T>;
+
+	// 擪countitemsɈڂĎ菜
+	template<typename T>
+	void PopFront(T& d, OUT typename T::value_type* const items, size_t count)
+	{
+		assert(count <= d.size());
+		std::move(d.begin(), d.begin() + count, items);
+		d.erase(d.begin(), d.begin() + count);
+	}
+}
+#else
+#include "Container/Deque.h"
+namespace Rizityo
+{
+	template<typename T>
+	void PopFront(T& d, OUT typename T::value_type* const items, size_t count)
+	{
+		d.pop_front(items, count);
+	}
 }
 #endif // USE_STL_DEQUE
 
-#include "Container/FreeList.h"
\ No newline at end of file
+#if USE_STL_HASH_MAP
+#include <unordered_map>
+namespace Rizityo
+{
+	template<typename K, typename V>
+	using HashMap = std::unordered_map<K, V>;
+}
+#else
+#include "Container/HashMap.h"
+#endif // USE_STL_HASH_MAP
+
+#include "Container/FreeList.h"
+#include "Container/PagedFreeList.h"
+#include "Container/Span.h"
+#include "Container/SlabPool.h"
\ No newline at end of file
@@ -228,6 +228,21 @@ namespace Rizityo::Graphics::D3D12::Camera
         Math::DX_Vector3 dir{ entity.GetTransformComponent().GetOrientation() };
         _Position = XMLoadFloat3(&pos);
         _Direction = XMLoadFloat3(&dir);
+        UpdateMatrices();
+    }
+
+    void D3D12Camera::Update(const Math::DX_Matrix4x4& world)
+    {
+        using namespace DirectX;
+        // 4sڂʒuA3sڂO(XP[{Ă)
+        _Position = XMVectorSet(world._41, world._42, world._43, 0.f);
+        _Direction = XMVector3Normalize(XMVectorSet(world._31, world._32, world._33, 0.f));
+        UpdateMatrices();
+    }
+
+    void D3D12Camera::UpdateMatrices()
+    {
+        using namespace DirectX;
         _View = XMMatrixLookToRH(_Position, _Direction, _UpVector); // EWn
 
         if (_UpdateFlag)
@@ -11,6 +11,8 @@ namespace Rizityo::Graphics::D3D12::Camera
         explicit D3D12Camera(CameraInitInfo info);
 
         void Update();
+        // GeBeB̃[hs񂩂ʒuƌ߂(t[pPbg`悷ꍇ)
+        void Update(const Math::DX_Matrix4x4& world);
 
         void SetUpVector(Math::DX_Vector3 up);
 
@@ -73,6 +75,8 @@ namespace Rizityo::Graphics::D3D12::Camera
         ID::IDType _EntityID;
 
         bool _UpdateFlag;
+
+        void UpdateMatrices();
     };
 
     Graphics::Camera CreateCamera(CameraInitInfo info);
@@ -17,16 +17,18 @@ namespace Rizityo::Graphics::D3D12::Content
 			uint32 ElementsType{};
 		};
 
-		FreeList<ID3D12Resource*> SubmeshBuffers{};
-		FreeList<SubmeshView> SubmeshViews{};
+		// `撆ɓǂނ̂PagedFreeListɒuAǉłǂ߂悤ɂ
+		// TubVƃ}eA̍폜͕`Xbh҂ɌĂׂ̂ŁAǂނƂbN
+		PagedFreeList<ID3D12Resource*> SubmeshBuffers{};
+		PagedFreeList<SubmeshView> SubmeshViews{};
 		std::mutex SubmeshMutex{};
 
 		FreeList<D3D12Texture> Textures;
 		std::mutex TextureMutex{};
 
-		Vector<ID3D12RootSignature*> RootSignatures;
-		std::unordered_map<uint64, ID::IDType> MaterialRootSignatureMap; // (}eA^Cv, VF[_[tO)烋[gVOl`[ւ̃}bv
-		FreeList<std::unique_ptr<uint8[]>> Materials;
+		PagedFreeList<ID3D12RootSignature*> RootSignatures; // ǉ̂(ID͒ǉ)
+		HashMap<uint64, ID::IDType> MaterialRootSignatureMap; // (}eA^Cv, VF[_[tO)烋[gVOl`[ւ̃}bv
+		PagedFreeList<std::unique_ptr<uint8[]>> Materials;
 		std::mutex MaterialMutex{};
 
 		ID::IDType CreateRootSignature(MaterialType::Type type, ShaderFlags::Flags flags);
@@ -146,9 +148,10 @@ namespace Rizityo::Graphics::D3D12::Content
 			ID::IDType DepthPSO_ID;
 		};
 
-		FreeList<D3D12RenderItem> RenderItems;
-		FreeList<std::unique_ptr<ID::IDType[]>> RenderItemIDs;
-		std::mutex RenderItemMutex{};
+		// `ACe͕`Xbh`IĂ폜(RenderThread::RemoveRenderItem)̂ŁAǂނƂ̓bNȂ
+		PagedFreeList<D3D12RenderItem> RenderItems;
+		PagedFreeList<std::unique_ptr<ID::IDType[]>> RenderItemIDs;
+		std::mutex RenderItemMutex{}; // ǉE폜p
 
 		struct PSO_ID
 		{
@@ -156,8 +159,8 @@ namespace Rizityo::Graphics::D3D12::Content
 			ID::IDType DepthPSO_ID{ ID::INVALID_ID };
 		};
 
-		Vector<ID3D12PipelineState*> PipelineStates;
-		std::unordered_map<uint64, ID::IDType> PSO_Map;
+		PagedFreeList<ID3D12PipelineState*> PipelineStates; // ǉ̂(ID͒ǉ)
+		HashMap<uint64, ID::IDType> PSO_Map;
 		std::mutex PSO_Mutex{};
 
 		struct {
@@ -272,8 +275,7 @@ namespace Rizityo::Graphics::D3D12::Content
 			}
 
 			assert(rootSignature);
-			const ID::IDType id{ (ID::IDType)RootSignatures.size() };
-			RootSignatures.emplace_back(rootSignature);
+			const ID::IDType id{ RootSignatures.Add(rootSignature) };
 			MaterialRootSignatureMap[key] = id;
 			SET_NAME_D3D12_OBJECT_INDEXED(rootSignature, key, L"GPass Root Signature - key");
 
@@ -301,9 +303,8 @@ namespace Rizityo::Graphics::D3D12::Content
 
 			{
 				std::lock_guard lock{ PSO_Mutex };
-				const ID::IDType id{ (uint32)PipelineStates.size() };
-				PipelineStates.emplace_back(pso);
-				SET_NAME_D3D12_OBJECT_INDEXED(PipelineStates.back(), key,
+				const ID::IDType id{ PipelineStates.Add(pso) };
+				SET_NAME_D3D12_OBJECT_INDEXED(pso, key,
 					isDepth ? L"Depth-only Pipeline State Object - key" : L"GPass Pipeline State Object - key");
 
 				PSO_Map[key] = id;
@@ -330,8 +331,7 @@ namespace Rizityo::Graphics::D3D12::Content
 
 			Helper::D3D12PipelineStateSubobjectStream& stream{ *(Helper::D3D12PipelineStateSubobjectStream* const)streamPtr };
 
-			{ // bNXR[v
-				std::lock_guard lock{ MaterialMutex };
+			{
 				const D3D12MaterialStream material{ Materials[materialID].get() };
 
 				D3D12_RT_FORMAT_ARRAY rtArray{};
@@ -391,21 +391,21 @@ namespace Rizityo::Graphics::D3D12::Content
 
 	void Shutdown()
 	{
-		for (auto& item : RootSignatures)
+		for (uint32 i = 0; i < RootSignatures.Capacity(); i++)
 		{
-			Core::Release(item);
+			Core::Release(RootSignatures[i]);
+			RootSignatures.Remove(i);
 		}
 
 		MaterialRootSignatureMap.clear();
-		RootSignatures.clear();
 
-		for (auto& item : PipelineStates)
+		for (uint32 i = 0; i < PipelineStates.Capacity(); i++)
 		{
-			Core::Release(item);
+			Core::Release(PipelineStates[i]);
+			PipelineStates.Remove(i);
 		}
 
 		PSO_Map.clear();
-		PipelineStates.clear();
 	}
 
 	namespace Submesh
@@ -568,7 +568,16 @@ namespace Rizityo::Graphics::D3D12::Content
 		ID::IDType Add(ID::IDType entityID, ID::IDType geometryContentID,
 			uint32 materialCount, const ID::IDType* const materialIDs)
 		{
-			assert(ID::IsValid(entityID) && ID::IsValid(geometryContentID));
+			ID::IDType id;
+			AddMany(&entityID, 1, geometryContentID, materialCount, materialIDs, &id);
+			return id;
+		}
+
+		// TubṼr[PSO͑SẴGeBeBœȂ̂1񂾂߁AbN1񂾂
+		void AddMany(const ID::IDType* const entityIDs, uint32 entityCount, ID::IDType geometryContentID,
+			uint32 materialCount, const ID::IDType* const materialIDs, OUT ID::IDType* const renderItemIDs)
+		{
+			assert(entityIDs && entityCount && renderItemIDs && ID::IsValid(geometryContentID));
 			assert(materialCount && materialIDs);
 			ID::IDType* const gpuIDs = (ID::IDType* const)alloca(materialCount * sizeof(ID::IDType));
 			Rizityo::Content::GetSubmeshGPU_IDs(geometryContentID, materialCount, gpuIDs);
@@ -584,31 +593,42 @@ namespace Rizityo::Graphics::D3D12::Content
 
 			Submesh::GetViews(gpuIDs, materialCount, viewsCache);
 
-			std::unique_ptr<ID::IDType[]> items{ std::make_unique<ID::IDType[]>(sizeof(ID::IDType) * (1 + (uint64)materialCount + 1)) };
-
-			items[0] = geometryContentID;
-			ID::IDType* const itemIDs{ &items[1] };
-
 			std::lock_guard lock{ RenderItemMutex };
 
+			// GeBeBɂȂɍĂ
+			D3D12RenderItem* const templates = (D3D12RenderItem* const)alloca(materialCount * sizeof(D3D12RenderItem));
 			for (uint32 i = 0; i < materialCount; i++)
 			{
-				D3D12RenderItem item{};
-				item.EntityID = entityID;
+				D3D12RenderItem& item{ templates[i] };
+				item = {};
 				item.SubmeshGPU_ID = gpuIDs[i];
 				item.MaterialID = materialIDs[i];
 				PSO_ID idPair{ CreatePSO(item.MaterialID, viewsCache.PrimitiveTopologies[i], viewsCache.ElementsTypes[i]) };
 				item.PSO_ID = idPair.GPassPSO_ID;
 				item.DepthPSO_ID = idPair.DepthPSO_ID;
-
 				assert(ID::IsValid(item.SubmeshGPU_ID) && ID::IsValid(item.MaterialID));
-				itemIDs[i] = RenderItems.Add(item);
 			}
 
-			// INVALID_IDŖ𖄂߂
-			itemIDs[materialCount] = ID::INVALID_ID;
+			for (uint32 e = 0; e < entityCount; e++)
+			{
+				assert(ID::IsValid(entityIDs[e]));
+				std::unique_ptr<ID::IDType[]> items{ std::make_unique<ID::IDType[]>(sizeof(ID::IDType) * (1 + (uint64)materialCount + 1)) };
+
+				items[0] = geometryContentID;
+				ID::IDType* const itemIDs{ &items[1] };
+
+				for (uint32 i = 0; i < materialCount; i++)
+				{
+					D3D12RenderItem item{ templates[i] };
+					item.EntityID = entityIDs[e];
+					itemIDs[i] = RenderItems.Add(item);
+				}
+
+				// INVALID_IDŖ𖄂߂
+				itemIDs[materialCount] = ID::INVALID_ID;
 
-			return RenderItemIDs.Add(std::move(items));
+				renderItemIDs[e] = RenderItemIDs.Add(std::move(items));
+			}
 		}
 
 		void Remove(ID::IDType id)
@@ -633,8 +653,6 @@ namespace Rizityo::Graphics::D3D12::Content
 			FrameCache.GeometryIDs.clear();
 			const uint32 count = frameInfo.RenderItemCount;
 
-			std::lock_guard lock{ RenderItemMutex };
-
 			// Geometry ID̎擾
 			for (uint32 i = 0; i < count; i++)
 			{
@@ -675,9 +693,6 @@ namespace Rizityo::Graphics::D3D12::Content
 			assert(cache.EntityIDs && cache.SubmeshGPU_IDs && cache.MaterialIDs &&
 				cache.GPassPSOs && cache.DepthPSOs);
 
-			std::lock_guard lock1{ RenderItemMutex };
-			std::lock_guard lock2{ PSO_Mutex };
-
 			for (uint32 i = 0; i < idCount; i++)
 			{
 				const D3D12RenderItem& item{ RenderItems[d3d12RenderItemIDs[i]] };
@@ -56,6 +56,9 @@ namespace Rizityo::Graphics::D3D12::Content
 		};
 
 		ID::IDType Add(ID::IDType entityID, ID::IDType geometryContentID, uint32 materialCount, const ID::IDType* const materialIDs);
+		// WIgƃ}eÃACeentityCount܂Ƃ߂Ēǉ
+		void AddMany(const ID::IDType* const entityIDs, uint32 entityCount, ID::IDType geometryContentID,
+			uint32 materialCount, const ID::IDType* const materialIDs, OUT ID::IDType* const renderItemIDs);
 		void Remove(ID::IDType id);
 		void GetD3D12RenderItemIDs(const FrameInfo& info, OUT Vector<ID::IDType>& d3d12RenderItemIDs);
 		void GetItems(const ID::IDType* const d3d12RenderItemIDs, uint32 idCount, OUT const ItemsCache& cache);
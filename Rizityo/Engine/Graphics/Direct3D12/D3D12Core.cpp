@@ -277,7 +277,16 @@ namespace Rizityo::Graphics::D3D12::Core
 										 const D3D12Surface& surface, uint32 frameIndex, float32 deltaTime)
 		{
 			Camera::D3D12Camera& camera{ Camera::GetCamera(info.CamerID) };
-			camera.Update();
+			if (info.World)
+			{
+				const ID::IDType index{ ID::GetIndex(camera.EntityID()) };
+				assert(index < info.TransformCount);
+				camera.Update(info.World[index]);
+			}
+			else
+			{
+				camera.Update();
+			}
 			HLSL::GlobalShaderData data{};
 
 			using namespace DirectX;
@@ -290,7 +299,7 @@ namespace Rizityo::Graphics::D3D12::Core
 			XMStoreFloat3(&data.CameraDirection, camera.Direction());
 			data.ViewWidth = (float32)surface.Width();
 			data.ViewHeight = (float32)surface.Height();
-			data.NumDirectionalLights = Light::GetNonCullableLightCount(info.LightSetKey);
+			data.NumDirectionalLights = info.DirectionalLightCount;
 			data.DeltaTime = deltaTime;
 
 			HLSL::GlobalShaderData* const shaderData = constantBuffer.Allocate<HLSL::GlobalShaderData>();
@@ -549,9 +558,6 @@ namespace Rizityo::Graphics::D3D12::Core
 		ID3D12GraphicsCommandList* cmdList{ GFX_Command.CommandList() };
 
 		const uint32 frameIndex = GetCurrentFrameIndex();
-		
-		// GUI̐ݒ
-		GUI::Show();
 
 		// 萔obt@̃Zbg
 		ConstantBuffer& cbuffer{ ConstantBuffers[frameIndex] };
@@ -609,7 +615,7 @@ namespace Rizityo::Graphics::D3D12::Core
 		Post::PostProcess(cmdList, d3d12Info, surface.RTV());
 
 		// GUI̕`
-		GUI::Render(cmdList);
+		GUI::Render(cmdList, info.GUIDrawData);
 
 		// \
 		Helper::TransitionResource(cmdList, currentBackBuffer,
@@ -37,11 +37,15 @@ namespace Rizityo::Graphics::D3D12::GUI
 		ImGui_ImplWin32_NewFrame();
 		ImGui::NewFrame();
 		Rizityo::GUI::Show();
+		ImGui::Render();
 	}
 
-	void Render(ID3D12GraphicsCommandList* cmdList)
+	void Render(ID3D12GraphicsCommandList* cmdList, const ImDrawData* drawData)
 	{
-		ImGui::Render();
-		ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), cmdList);
+		if (!drawData)
+			return;
+
+		// ʂ͕`Xbhǂ܂Ȃ̂ŁA邱Ƃ͂Ȃ
+		ImGui_ImplDX12_RenderDrawData(const_cast<ImDrawData*>(drawData), cmdList);
 	}
 }
\ No newline at end of file
@@ -6,6 +6,8 @@ namespace Rizityo::Graphics::D3D12::GUI
 	bool Initialize();
 	void Shutdown();
 
+	// CXbhŃt[ImGui::Render()܂ōs
 	void Show();
-	void Render(ID3D12GraphicsCommandList* cmdList);
+	// Showō`f[^̎ʂ`悷(ImGuĩReLXgɂ͐GȂ)
+	void Render(ID3D12GraphicsCommandList* cmdList, const ImDrawData* drawData);
 }
\ No newline at end of file
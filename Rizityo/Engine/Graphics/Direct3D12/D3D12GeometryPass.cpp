@@ -202,6 +202,7 @@ namespace Rizityo::Graphics::D3D12::GPass
 			HLSL::PerObjectData* currentDataPointer = nullptr;
 
 			ConstantBuffer& cbuffer{ Core::GetConstantBuffer() };
+			const FrameInfo& info{ *d3d12Info.FrameInfo };
 
 			using namespace DirectX;
 			for (uint32 i = 0; i < renderItemsCount; i++)
@@ -210,7 +211,18 @@ namespace Rizityo::Graphics::D3D12::GPass
 				{
 					currentEntityID = cache.EntityIDs[i];
 					HLSL::PerObjectData data{};
-					Transform::GetTransformMatrices(GameEntity::EntityID{ currentEntityID }, data.World, data.InvWorld);
+					if (info.World)
+					{
+						// `Xbhł̓t[pPbg̍sg
+						const ID::IDType index{ ID::GetIndex(currentEntityID) };
+						assert(index < info.TransformCount);
+						data.World = info.World[index];
+						data.InvWorld = info.InvWorld[index];
+					}
+					else
+					{
+						Transform::GetTransformMatrices(GameEntity::EntityID{ currentEntityID }, data.World, data.InvWorld);
+					}
 					XMMATRIX world{ XMLoadFloat4x4(&data.World) };
 					XMMATRIX wvp{ XMMatrixMultiply(world, d3d12Info.Camera->ViewProjection()) };
 					XMStoreFloat4x4(&data.WorldViewProjection, wvp);
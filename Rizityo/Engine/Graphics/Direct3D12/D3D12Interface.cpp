@@ -4,6 +4,7 @@
 #include "D3D12Content.h"
 #include "D3D12Camera.h"
 #include "D3D12Light.h"
+#include "D3D12GUI.h"
 #include "Graphics/GraphicsInterface.h"
 
 namespace Rizityo::Graphics::D3D12
@@ -12,6 +13,7 @@ namespace Rizityo::Graphics::D3D12
 	{
 		graphicsInterface.Initialize = Core::Initialize;
 		graphicsInterface.Shutdown = Core::Shutdown;
+		graphicsInterface.BuildGUI = GUI::Show;
 
 		graphicsInterface.Surface.Create = Core::CreateSurface;
 		graphicsInterface.Surface.Remove = Core::RemoveSurface;
@@ -25,6 +27,7 @@ namespace Rizityo::Graphics::D3D12
 		graphicsInterface.Resources.AddMaterial = Content::Material::Add;
 		graphicsInterface.Resources.RemoveMaterial = Content::Material::Remove;
 		graphicsInterface.Resources.AddRenderItem = Content::RenderItem::Add;
+		graphicsInterface.Resources.AddRenderItems = Content::RenderItem::AddMany;
 		graphicsInterface.Resources.RemoveRenderItem = Content::RenderItem::Remove;
 
 		graphicsInterface.Camera.Create = Camera::CreateCamera;
@@ -36,6 +39,7 @@ namespace Rizityo::Graphics::D3D12
 		graphicsInterface.Light.Remove = Light::Remove;
 		graphicsInterface.Light.SetParameter = Light::SetParameter;
 		graphicsInterface.Light.GetParameter = Light::GetParameter;
+		graphicsInterface.Light.CopyLights = Light::CopyLights;
 
 		graphicsInterface.Platform = GraphicsPlatform::Direct3D12;
 	}
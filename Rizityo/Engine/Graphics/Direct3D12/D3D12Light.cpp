@@ -16,12 +16,6 @@ namespace Rizityo::Graphics::D3D12::Light
 			bool IsEnabled;
 		};
 
-#if USE_STL_VECTOR
-#define CONSTEXPR
-#else
-#define CONSTEXPR constexpr
-#endif
-
 		class LightSet
 		{
 		public:
@@ -30,25 +24,13 @@ namespace Rizityo::Graphics::D3D12::Light
 			{
 				if (info.Type == Graphics::Light::Directional)
 				{
-					uint32 index = UINT32_INVALID_NUM;
-
-					// p\ȃCfbNX
-					for (uint32 i = 0; i < _NonCullableOwners.size(); i++)
-					{
-						if (!ID::IsValid(_NonCullableOwners[i]))
-						{
-							index = i;
-							break;
-						}
-					}
-
-					// p\ȃCfbNXΒǉ
-					if (index == UINT32_INVALID_NUM)
+					// 폜ꏊΎg܂킷(p[^[͓CfbNXɒu)
+					const uint32 index{ _NonCullableOwners.Add(LightID{ ID::INVALID_ID }) };
+					if (index == _NonCullableLights.size())
 					{
-						index = (uint32)_NonCullableOwners.size();
-						_NonCullableOwners.emplace_back();
 						_NonCullableLights.emplace_back();
 					}
+					assert(index < _NonCullableLights.size());
 
 					HLSL::DirectionalLightParameters& params{ _NonCullableLights[index] };
 					params.Color = info.Color;
@@ -74,7 +56,7 @@ namespace Rizityo::Graphics::D3D12::Light
 
 				if (owner.Type == Graphics::Light::Directional)
 				{
-					_NonCullableOwners[owner.Index] = LightID{ ID::INVALID_ID };
+					_NonCullableOwners.Remove(owner.Index);
 				}
 				else
 				{
@@ -84,23 +66,36 @@ namespace Rizityo::Graphics::D3D12::Light
 				_Owners.Remove(id);
 			}
 
-			void UpdateTransforms()
+			// LDirectional Light`Xbhɓn߂Ɏʂ
+			// Directional Light_NonCullableOwners̐Ăvf񂷂̂ŁA̎ނ̃Cg폜ς݂̏ꏊ͂̕Ȃ
+			void CopyNonCullableLights(const FrameInfo& info, OUT Vector<DirectionalLightSnapshot>& lights) const
 			{
-				// DirectionXV
-				for (const auto& id : _NonCullableOwners)
+				lights.clear();
+				for (const LightID id : _NonCullableOwners)
 				{
-					if (!ID::IsValid(id))
+					const LightOwner& owner{ _Owners[id] };
+					if (!owner.IsEnabled)
 						continue;
 
-					const LightOwner& owner{ _Owners[id] };
-					if (owner.IsEnabled)
+					const HLSL::DirectionalLightParameters& params{ _NonCullableLights[owner.Index] };
+					DirectionalLightSnapshot& light{ lights.emplace_back() };
+					light.Intensity = params.Intensity;
+					light.Color = params.Color;
+					if (info.World)
+					{
+						// t[pPbg̃[hs3sڂO(XP[{Ă)
+						using namespace DirectX;
+						const ID::IDType index{ ID::GetIndex(owner.EntityID) };
+						assert(index < info.TransformCount);
+						const Math::DX_Matrix4x4& world{ info.World[index] };
+						XMStoreFloat3(&light.Direction, XMVector3Normalize(XMVectorSet(world._31, world._32, world._33, 0.f)));
+					}
+					else
 					{
 						const GameEntity::Entity entity{ GameEntity::EntityID{owner.EntityID} };
-						HLSL::DirectionalLightParameters& params{ _NonCullableLights[owner.Index] };
-						params.Direction = entity.GetOrientation();
+						light.Direction = entity.GetOrientation();
 					}
 				}
-
 			}
 
 			constexpr void SetEnable(LightID id, bool isEnabled)
@@ -194,39 +189,6 @@ namespace Rizityo::Graphics::D3D12::Light
 				return _Owners[id].EntityID;
 			}
 
-			// LDirectional Light̐
-			CONSTEXPR uint32 GetNonCullableLightCount() const
-			{
-				uint32 count = 0;
-				for (const auto& id : _NonCullableOwners)
-				{
-					if (ID::IsValid(id) && _Owners[id].IsEnabled)
-						count++;
-				}
-
-				return count;
-			}
-
-			CONSTEXPR void GetNonCullableLights(OUT HLSL::DirectionalLightParameters* const lights, [[maybe_unused]] uint32 bufferSize)
-			{
-				assert(bufferSize == Math::AlignSizeUp<D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT>(GetNonCullableLightCount() * sizeof(HLSL::DirectionalLightParameters)));
-				const uint32 count = (uint32)_NonCullableOwners.size();
-				uint32 index = 0;
-				for (uint32 i = 0; i < count; i++)
-				{
-					if (!ID::IsValid(_NonCullableOwners[i]))
-						continue;
-
-					const LightOwner& owner{ _Owners[_NonCullableOwners[i]] };
-					if (owner.IsEnabled)
-					{
-						assert(_Owners[_NonCullableOwners[i]].Index == i);
-						lights[index] = _NonCullableLights[i];
-						index++;
-					}
-				}
-			}
-
 			constexpr bool HasLights() const
 			{
 				return _Owners.Size() > 0;
@@ -236,8 +198,8 @@ namespace Rizityo::Graphics::D3D12::Light
 
 			// ^CgɃpbNKv͂Ȃ
 			FreeList<LightOwner> _Owners;
-			Vector<HLSL::DirectionalLightParameters> _NonCullableLights;
-			Vector<LightID> _NonCullableOwners;
+			Vector<HLSL::DirectionalLightParameters> _NonCullableLights; // _NonCullableOwnersƓCfbNX
+			FreeList<LightID> _NonCullableOwners; // Directional Light(CfbNXLightOwner::Index)
 
 		};
 
@@ -247,10 +209,11 @@ namespace Rizityo::Graphics::D3D12::Light
 
 			D3D12LightBuffer() = default;
 
-			CONSTEXPR void UpdateLightBuffers(LightSet& set, uint64 lightSetKey, uint32 frameIndex)
+			// t[pPbgɎʂCg(CgZbgɂ͐GȂ)
+			void UpdateLightBuffers(const FrameInfo& info, uint32 frameIndex)
 			{
 				uint32 sizes[LightBuffer::Count]{};
-				sizes[LightBuffer::NonCullableLight] = set.GetNonCullableLightCount() * sizeof(HLSL::DirectionalLightParameters);
+				sizes[LightBuffer::NonCullableLight] = info.DirectionalLightCount * sizeof(HLSL::DirectionalLightParameters);
 
 				uint32 currentSizes[LightBuffer::Count]{};
 				currentSizes[LightBuffer::NonCullableLight] = _Buffers[LightBuffer::NonCullableLight].Buffer.Size();
@@ -261,8 +224,14 @@ namespace Rizityo::Graphics::D3D12::Light
 					ResizeBuffer(LightBuffer::NonCullableLight, sizes[LightBuffer::NonCullableLight], frameIndex);
 				}
 
-				set.GetNonCullableLights((HLSL::DirectionalLightParameters* const)_Buffers[LightBuffer::NonCullableLight].CPU_Address,
-					_Buffers[LightBuffer::NonCullableLight].Buffer.Size());
+				HLSL::DirectionalLightParameters* const lights{ (HLSL::DirectionalLightParameters* const)_Buffers[LightBuffer::NonCullableLight].CPU_Address };
+				for (uint32 i = 0; i < info.DirectionalLightCount; i++)
+				{
+					const DirectionalLightSnapshot& light{ info.DirectionalLights[i] };
+					lights[i].Direction = light.Direction;
+					lights[i].Intensity = light.Intensity;
+					lights[i].Color = light.Color;
+				}
 
 			}
 
@@ -315,9 +284,7 @@ namespace Rizityo::Graphics::D3D12::Light
 			uint64 _CurrentLightSetKey = 0;
 		};
 
-#undef CONSTEXPR
-
-		std::unordered_map<uint64, LightSet> LightSetsMap;
+		HashMap<uint64, LightSet> LightSetsMap;
 		D3D12LightBuffer LightBuffers[FrameBufferCount];
 
 	} // ϐ
@@ -468,18 +435,27 @@ namespace Rizityo::Graphics::D3D12::Light
 
 	}
 
+	void CopyLights(uint64 lightSetKey, const FrameInfo& info, OUT Vector<DirectionalLightSnapshot>& lights)
+	{
+		// CgÕt[łĂ΂̂ŁACgZbg΃Cgɂ
+		const auto iter{ LightSetsMap.find(lightSetKey) };
+		if (iter == LightSetsMap.end())
+		{
+			lights.clear();
+			return;
+		}
+		iter->second.CopyNonCullableLights(info, lights);
+	}
+
 	void UpdateLightBuffers(const D3D12FrameInfo& d3d12Info)
 	{
-		const uint64 lightSetKey = d3d12Info.FrameInfo->LightSetKey;
-		assert(LightSetsMap.count(lightSetKey));
-		LightSet& set{ LightSetsMap[lightSetKey] };
-		if (!set.HasLights())
+		const FrameInfo& info{ *d3d12Info.FrameInfo };
+		if (!info.DirectionalLightCount)
 			return;
 
-		set.UpdateTransforms();
 		const uint32 frameIndex = d3d12Info.FrameIndex;
 		D3D12LightBuffer& lightBuffer{ LightBuffers[frameIndex] };
-		lightBuffer.UpdateLightBuffers(set, lightSetKey, frameIndex);
+		lightBuffer.UpdateLightBuffers(info, frameIndex);
 	}
 
 	D3D12_GPU_VIRTUAL_ADDRESS GetNonCullableLightBuffer(uint32 frameIndex)
@@ -488,10 +464,4 @@ namespace Rizityo::Graphics::D3D12::Light
 		return lightBuffer.GetNonCullableLights();
 	}
 
-	uint32 GetNonCullableLightCount(uint64 lightSetKey)
-	{
-		assert(LightSetsMap.count(lightSetKey));
-		return LightSetsMap[lightSetKey].GetNonCullableLightCount();
-	}
-
 }
\ No newline at end of file
@@ -15,8 +15,10 @@ namespace Rizityo::Graphics::D3D12::Light
 	void Remove(LightID id, uint64 lightSetKey);
 	void SetParameter(LightID id, uint64 lightSetKey, LightParameter::Parameter parameter, const void* const data, uint32 dataSize);
 	void GetParameter(LightID id, uint64 lightSetKey, LightParameter::Parameter parameter, OUT void* const data, uint32 dataSize);
+	// CXbhŌĂ
+	void CopyLights(uint64 lightSetKey, const FrameInfo& info, OUT Vector<DirectionalLightSnapshot>& lights);
 
+	// `XbhŌĂ(t[pPbgɎʂCgg)
 	void UpdateLightBuffers(const D3D12FrameInfo& d3d12Info);
 	D3D12_GPU_VIRTUAL_ADDRESS GetNonCullableLightBuffer(uint32 frameIndex);
-	uint32 GetNonCullableLightCount(uint64 lightSetKey);
 }
\ No newline at end of file
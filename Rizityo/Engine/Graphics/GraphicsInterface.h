@@ -8,6 +8,7 @@ namespace Rizityo::Graphics
 	{
 		bool(*Initialize)(void);
 		void(*Shutdown)(void);
+		void(*BuildGUI)(void);
 
 		struct
 		{
@@ -26,6 +27,7 @@ namespace Rizityo::Graphics
 			ID::IDType(*AddMaterial)(MaterialInitInfo);
 			void (*RemoveMaterial)(ID::IDType);
 			ID::IDType(*AddRenderItem)(ID::IDType, ID::IDType, uint32, const ID::IDType* const);
+			void (*AddRenderItems)(const ID::IDType* const, uint32, ID::IDType, uint32, const ID::IDType* const, ID::IDType* const);
 			void (*RemoveRenderItem)(ID::IDType);
 		} Resources;
 
@@ -42,6 +44,7 @@ namespace Rizityo::Graphics
 			void(*Remove)(LightID, uint64);
 			void(*SetParameter)(LightID, uint64, LightParameter::Parameter, const void* const, uint32);
 			void(*GetParameter)(LightID, uint64, LightParameter::Parameter, void* const, uint32);
+			void(*CopyLights)(uint64, const FrameInfo&, Vector<DirectionalLightSnapshot>&);
 		} Light;
 
 		GraphicsPlatform Platform = (GraphicsPlatform)-1;
@@ -0,0 +1,174 @@
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // !WIN32_LEAN_AND_MEAN
+
+#include <Windows.h>
+#include "RenderThread.h"
+#include <thread>
+#include <atomic>
+
+namespace Rizityo::Graphics::RenderThread
+{
+	namespace
+	{
+		// pPbg3ACXbhݒE󂯓n҂E`Xbh`撆Aŉ
+		// 󂯓nPublishedƂ̓ւ(exchange)ōŝŁASubmit̓bN炸A`҂ƂȂ
+		// `悪ǂȂꍇA󂯓n҂̃pPbg͎SubmitŐV̂ɒu(Ât[͕`Ȃ)
+		constexpr uint32 PacketCount{ 3 };
+		constexpr uint32 NewPacketBit{ 1u << 31 }; // Published̃pPbg܂`XbhɎĂȂ
+
+		FramePacket Packets[PacketCount];
+		uint64 PacketFrames[PacketCount]{}; // pPbgnƂ̃t[ԍ
+		uint32 WriteIndex = 0; // CXbhłpPbg(CXbhg)
+		uint32 ReadIndex = 1; // `XbhŌɎpPbg(`Xbhg)
+		std::atomic<uint32> Published{ 2 }; // 󂯓n҂̃pPbg
+
+		uint64 SubmittedFrame = 0; // Ōɓnt[ԍ(CXbhg)
+		std::atomic<uint64> RenderedFrame{ 0 }; // `IŌ̃t[ԍ(O̒ut[ς񂾂ƂɂȂ)
+
+		// `Xbhn̂ĖƂƁAFlushŕ`҂Ƃg(ǂZbg)
+		HANDLE PublishedEvent = nullptr; // SubmitEShutdownŗĂ
+		HANDLE RenderedEvent = nullptr; // 1t[`I邽тɗĂ
+		std::atomic<bool> Running{ false };
+		std::thread Thread;
+
+		// 폜҂Ă`ACe(CXbhg)
+		// 폜_܂łɓnpPbgQƂĂ邩Ȃ̂ŁÃt[`I܂Ŏc
+		struct PendingRenderItem
+		{
+			uint64 Frame; // ̃t[`I폜ł
+			ID::IDType ID;
+		};
+		Deque<PendingRenderItem> PendingRenderItems;
+
+	} // ϐ
+
+	namespace
+	{
+		void Render(const FramePacket& packet)
+		{
+			if (!ID::IsValid(packet.Surface))
+				return;
+
+			Surface{ packet.Surface }.Render(packet.GetFrameInfo());
+		}
+
+		void RenderLoop()
+		{
+			while (true)
+			{
+				if (!(Published.load(std::memory_order_acquire) & NewPacketBit))
+				{
+					// nt[`IĂ~܂
+					if (!Running.load(std::memory_order_acquire))
+						return;
+
+					// mF̌SubmitĂĂCxg͗܂܂Ȃ̂ŁAɋN
+					WaitForSingleObject(PublishedEvent, INFINITE);
+					continue;
+				}
+
+				// `IpPbgԂA󂯓n҂̃pPbg󂯎
+				ReadIndex = Published.exchange(ReadIndex, std::memory_order_acq_rel) & ~NewPacketBit;
+				Render(Packets[ReadIndex]);
+
+				RenderedFrame.store(PacketFrames[ReadIndex], std::memory_order_release);
+				SetEvent(RenderedEvent);
+			}
+		}
+
+		// renderedFrame܂ł`IĂΎQƂȂ`ACe폜(t[ɕł)
+		void ReleaseRenderItems(uint64 renderedFrame)
+		{
+			while (!PendingRenderItems.empty() && PendingRenderItems.front().Frame <= renderedFrame)
+			{
+				Graphics::RemoveRenderItem(PendingRenderItems.front().ID);
+				PendingRenderItems.pop_front();
+			}
+		}
+
+	} // ֐
+
+	void Initialize()
+	{
+		assert(!IsInitialized());
+		PublishedEvent = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+		RenderedEvent = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+		assert(PublishedEvent && RenderedEvent);
+		Running = true;
+		Thread = std::thread{ RenderLoop };
+	}
+
+	void Shutdown()
+	{
+		if (!IsInitialized())
+			return;
+
+		// nt[͕`IĂ~߂
+		Flush();
+		Running.store(false, std::memory_order_release);
+		SetEvent(PublishedEvent);
+		Thread.join();
+
+		CloseHandle(PublishedEvent);
+		CloseHandle(RenderedEvent);
+		PublishedEvent = nullptr;
+		RenderedEvent = nullptr;
+	}
+
+	bool IsInitialized()
+	{
+		return Thread.joinable();
+	}
+
+	FramePacket& BeginPacket()
+	{
+		return Packets[WriteIndex];
+	}
+
+	void Submit()
+	{
+		// ImGuĩt[ƃCg̓CXbhŎʂA`Xbhɂ̓pPbgn
+		BuildGUI(Packets[WriteIndex]);
+		CopyLights(Packets[WriteIndex]);
+
+		if (!IsInitialized())
+		{
+			Render(Packets[WriteIndex]);
+			return;
+		}
+
+		// 񂾃pPbg󂯓n҂ɂAɕ`XbhȂ`IpPbg󂯎
+		PacketFrames[WriteIndex] = ++SubmittedFrame;
+		WriteIndex = Published.exchange(WriteIndex | NewPacketBit, std::memory_order_acq_rel) & ~NewPacketBit;
+		SetEvent(PublishedEvent);
+
+		ReleaseRenderItems(RenderedFrame.load(std::memory_order_acquire));
+	}
+
+	void Flush()
+	{
+		if (!IsInitialized())
+			return;
+
+		// Cxg͑Õt[`IƂ̂̂cĂ邱Ƃ̂ŁAt[ԍmߒ
+		while (RenderedFrame.load(std::memory_order_acquire) < SubmittedFrame)
+		{
+			WaitForSingleObject(RenderedEvent, INFINITE);
+		}
+
+		ReleaseRenderItems(SubmittedFrame);
+	}
+
+	void RemoveRenderItem(ID::IDType id)
+	{
+		assert(ID::IsValid(id));
+		if (!IsInitialized())
+		{
+			Graphics::RemoveRenderItem(id);
+			return;
+		}
+
+		PendingRenderItems.push_back(PendingRenderItem{ SubmittedFrame, id });
+	}
+}
\ No newline at end of file
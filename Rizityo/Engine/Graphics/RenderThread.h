@@ -0,0 +1,24 @@
+#pragma once
+#include "Renderer.h"
+
+// `p̃XbhŃt[pPbg`悵Ãt[̃V~[Vƕs
+// pPbg3񂵁A`XbhǂłȂ̂ɃCXbh(Submit͕`҂Ȃ)
+// `悪ǂȂꍇ́A܂`ĂȂÂt[Vt[Œu
+// `撆̃T[tFXEJE\[XύXE폜OɂFlushĂԂ(`ACeRemoveRenderItemō폜x点̂ŗvȂ)
+// ĂȂꍇASubmit͂̏ŕ`悷
+namespace Rizityo::Graphics::RenderThread
+{
+	void Initialize();
+	void Shutdown();
+	[[nodiscard]] bool IsInitialized();
+
+	// ɏރpPbg(`Xbh͓ǂłȂ)
+	[[nodiscard]] FramePacket& BeginPacket();
+	// 񂾃pPbg`Xbhɓn
+	void Submit();
+	// `Xbhɓnt[̕`悪I܂ő҂(폜҂Ă`ACeō폜)
+	void Flush();
+	// `ACeA܂łɓnt[`Xbh`IĂ폜(҂Ȃ)
+	// 폜SubmitFlush̒ŃCXbhs
+	void RemoveRenderItem(ID::IDType id);
+}
\ No newline at end of file
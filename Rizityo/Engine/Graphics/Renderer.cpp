@@ -3,6 +3,7 @@
 #include "Renderer.h"
 #include "GraphicsInterface.h"
 #include "Direct3D12/D3D12Interface.h"
+#include "ImGui/imgui.h"
 
 namespace Rizityo::Graphics
 {
@@ -16,6 +17,17 @@ namespace Rizityo::Graphics
 
 		GraphicsInterface GFXInterface{};
 
+		// vf킹Ă璆gʂ(ImVectoȓ͈x̂ŁAmۂobt@g܂킹Ȃ)
+		template<typename T>
+		void CopyImVector(ImVector<T>& dst, const ImVector<T>& src)
+		{
+			dst.resize(src.Size);
+			if (src.Size)
+			{
+				memcpy(dst.Data, src.Data, (size_t)src.Size * sizeof(T));
+			}
+		}
+
 		bool SetPlatformInterface(GraphicsPlatform platform, OUT GraphicsInterface& gi)
 		{
 			switch (platform)
@@ -50,6 +62,76 @@ namespace Rizityo::Graphics
 	}
 
 
+	void BuildGUI(FramePacket& packet)
+	{
+		GFXInterface.BuildGUI();
+		packet.GUI.Copy(ImGui::GetDrawData());
+	}
+
+	void CopyLights(FramePacket& packet)
+	{
+		GFXInterface.Light.CopyLights(packet.LightSetKey, packet.GetFrameInfo(), packet.DirectionalLights);
+	}
+
+	GUIDrawData::~GUIDrawData()
+	{
+		for (ImDrawList* const list : _Lists)
+		{
+			IM_DELETE(list);
+		}
+		IM_DELETE(_DrawData);
+	}
+
+	void GUIDrawData::Copy(const ImDrawData* const drawData)
+	{
+		if (!drawData || !drawData->Valid)
+		{
+			if (_DrawData)
+			{
+				_DrawData->Clear();
+			}
+			return;
+		}
+
+		if (!_DrawData)
+		{
+			_DrawData = IM_NEW(ImDrawData)();
+		}
+
+		// Ȃ`惊Xg
+		while (_Lists.size() < (uint64)drawData->CmdListsCount)
+		{
+			_Lists.emplace_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+		}
+
+		ImDrawData& dst{ *_DrawData };
+		dst.Clear();
+		for (int32 i = 0; i < drawData->CmdListsCount; i++)
+		{
+			const ImDrawList* const src{ drawData->CmdLists[i] };
+			ImDrawList* const list{ _Lists[i] };
+			CopyImVector(list->CmdBuffer, src->CmdBuffer);
+			CopyImVector(list->IdxBuffer, src->IdxBuffer);
+			CopyImVector(list->VtxBuffer, src->VtxBuffer);
+			list->Flags = src->Flags;
+			dst.CmdLists.push_back(list);
+		}
+		dst.CmdListsCount = drawData->CmdListsCount;
+		dst.TotalIdxCount = drawData->TotalIdxCount;
+		dst.TotalVtxCount = drawData->TotalVtxCount;
+		dst.DisplayPos = drawData->DisplayPos;
+		dst.DisplaySize = drawData->DisplaySize;
+		dst.FramebufferScale = drawData->FramebufferScale;
+		dst.OwnerViewport = drawData->OwnerViewport;
+		dst.Valid = true;
+	}
+
+	const ImDrawData* GUIDrawData::Get() const
+	{
+		return (_DrawData && _DrawData->Valid) ? _DrawData : nullptr;
+	}
+
+
 	// T[tFX
 	Surface CreateSurface(Platform::Window window)
 	{
@@ -114,6 +196,12 @@ namespace Rizityo::Graphics
 		return GFXInterface.Resources.AddRenderItem(entityID, geometryContentID, materialCount, materialIDs);
 	}
 
+	void AddRenderItems(const ID::IDType* const entityIDs, uint32 entityCount, ID::IDType geometryContentID,
+						uint32 materialCount, const ID::IDType* const materialIDs, OUT ID::IDType* const renderItemIDs)
+	{
+		GFXInterface.Resources.AddRenderItems(entityIDs, entityCount, geometryContentID, materialCount, materialIDs, renderItemIDs);
+	}
+
 	void RemoveRenderItem(ID::IDType id)
 	{
 		GFXInterface.Resources.RemoveRenderItem(id);
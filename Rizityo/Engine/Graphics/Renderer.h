@@ -4,6 +4,9 @@
 #include "API/Camera.h"
 #include "API/Light.h"
 
+struct ImDrawData;
+struct ImDrawList;
+
 namespace Rizityo::Graphics
 {
 	enum class GraphicsPlatform : uint32
@@ -16,6 +19,14 @@ namespace Rizityo::Graphics
     bool Initialize(GraphicsPlatform platform);
     void Shutdown();
 
+    // `XbhɓnLDirectional Light̎ʂ
+    struct DirectionalLightSnapshot
+    {
+        Math::DX_Vector3 Direction;
+        float32 Intensity;
+        Math::DX_Vector3 Color;
+    };
+
     struct FrameInfo
     {
         ID::IDType* RenderItemIDs = nullptr;
@@ -25,10 +36,78 @@ namespace Rizityo::Graphics
         uint64 LightSetKey = 0;
         float32 LastFrameTime = 16.7f;
         float32 AverageFrameTime = 16.7f;
+        // GeBeBindex -> [hs(nullptȑꍇTransform璼ړǂ)
+        const Math::DX_Matrix4x4* World = nullptr;
+        const Math::DX_Matrix4x4* InvWorld = nullptr;
+        uint32 TransformCount = 0;
+        const ImDrawData* GUIDrawData = nullptr; // `悷ImGuĩt[(nullptrȂ`Ȃ)
+        const DirectionalLightSnapshot* DirectionalLights = nullptr;
+        uint32 DirectionalLightCount = 0;
     };
 
+    // CXbhImGui::Render()`f[^̎ʂ
+    // ImGuĩReLXg̓CXbh̃EBhEvV[ŴŁA`Xbhɂ͂ꂾn
+    // `惊Xg̃obt@͎ɎʂƂɎg܂킷
+    class GUIDrawData
+    {
+    public:
+        GUIDrawData() = default;
+        GUIDrawData(const GUIDrawData&) = delete;
+        GUIDrawData& operator=(const GUIDrawData&) = delete;
+        ~GUIDrawData();
+
+        // drawDatanullptrȂɂ
+        void Copy(const ImDrawData* drawData);
+        // ʂ̂nullptr
+        [[nodiscard]] const ImDrawData* Get() const;
+
+    private:
+        ImDrawData* _DrawData = nullptr;
+        Vector<ImDrawList*> _Lists;
+    };
+
+    DEFINE_ID_TYPE(SurfaceID);
+
+    // V~[Vōĕ`Xbhɓn1t[̕`̓e
+    // `Xbh͓ǂݍނŁAGeBeBTransformɂ͐GȂ
+    struct FramePacket
+    {
+        Vector<ID::IDType> RenderItemIDs;
+        Vector<float32> Thresholds;
+        Vector<Math::DX_Matrix4x4> World;
+        Vector<Math::DX_Matrix4x4> InvWorld;
+        SurfaceID Surface{ ID::INVALID_ID };
+        CameraID CamerID{ ID::INVALID_ID };
+        uint64 LightSetKey = 0;
+        GUIDrawData GUI; // BuildGUIŎʂ
+        Vector<DirectionalLightSnapshot> DirectionalLights; // CopyLightsŎʂ
+
+        // pPbg̔zwFrameInfo(pPbg܂ŗL)
+        [[nodiscard]] FrameInfo GetFrameInfo() const
+        {
+            FrameInfo info{};
+            info.RenderItemIDs = const_cast<ID::IDType*>(RenderItemIDs.data());
+            info.Thresholds = const_cast<float32*>(Thresholds.data());
+            info.RenderItemCount = (uint32)RenderItemIDs.size();
+            info.CamerID = CamerID;
+            info.LightSetKey = LightSetKey;
+            info.World = World.data();
+            info.InvWorld = InvWorld.data();
+            info.TransformCount = (uint32)World.size();
+            info.GUIDrawData = GUI.Get();
+            info.DirectionalLights = DirectionalLights.data();
+            info.DirectionalLightCount = (uint32)DirectionalLights.size();
+            return info;
+        }
+    };
+
+    // CXbhImGuĩt[ImGui::Render()A`f[^pPbgɎʂ
+    void BuildGUI(FramePacket& packet);
+    // CXbhLightSetKeỹCg̃p[^[pPbgɎʂ(̓pPbg̃[hs񂩂狁߂)
+    // `Xbh̓CgZbgǂ܂Ȃ̂ŁA`撆ɃCgύXE폜Ă悢
+    void CopyLights(FramePacket& packet);
+
     // T[tFX
-	DEFINE_ID_TYPE(SurfaceID);
 	class Surface
 	{
 	public:
@@ -120,6 +199,10 @@ namespace Rizityo::Graphics
 
     ID::IDType AddRenderItem(ID::IDType entityID, ID::IDType geometryContentID,
                                uint32 materialCount, const ID::IDType* const materialIDs);
+    // WIgƃ}eA̕`ACeentityCount܂Ƃ߂Ēǉ
+    void AddRenderItems(const ID::IDType* const entityIDs, uint32 entityCount, ID::IDType geometryContentID,
+                        uint32 materialCount, const ID::IDType* const materialIDs, OUT ID::IDType* const renderItemIDs);
+    // `XbhꍇRenderThread::RemoveRenderItemg(`撆̃ACe폜Ȃ悤)
     void RemoveRenderItem(ID::IDType id);
 
 	const char* GetEngineShadersPath();
@@ -11,9 +11,10 @@ namespace Rizityo::Input
             bool IsDirty = true; // l擾ƂtruełΒlXV(KvɂȂXV)
         };
 
-        std::unordered_map<uint64, InputValue> InputValueMap;       // L[(typecodeȂ)
-        std::unordered_map<uint64, InputBinding> InputBindingMap;   // L[̓oCfBOpɐݒ肵
-        std::unordered_map<uint64, uint64> BindingKeyMap;           // L[(typecodeȂ)
+        // HashMap͒ǉŗvf̂ŁAQƂ܂ܒǉȂ(lǂނ̊֐find()gAǉȂ)
+        HashMap<uint64, InputValue> InputValueMap;       // L[(typecodeȂ)
+        HashMap<uint64, InputBinding> InputBindingMap;   // L[̓oCfBOpɐݒ肵
+        HashMap<uint64, uint64> BindingKeyMap;           // L[(typecodeȂ)
         Vector<Internal::InputSystemBase*> InputSystems;
 
         constexpr uint64 GetKey(InputSource::Type type, uint32 code)
@@ -91,16 +92,17 @@ namespace Rizityo::Input
     {
         assert(type < InputSource::Count);
         const uint64 key = GetKey(type, code);
-        InputValue& input{ InputValueMap[key] };
+        InputValue& input{ InputValueMap[key] }; // ȍ~InputValueMapɒǉȂ
         input.Previous = input.Current;
         input.Current = value;
 
-        if (BindingKeyMap.count(key))
+        const auto bindingKeyIter{ BindingKeyMap.find(key) };
+        if (bindingKeyIter != BindingKeyMap.end())
         {
-            const uint64 bindingKey = BindingKeyMap[key];
-            assert(InputBindingMap.count(bindingKey));
-            InputBinding& binding{ InputBindingMap[bindingKey] };
-            binding.IsDirty = true;
+            const uint64 bindingKey = bindingKeyIter->second;
+            const auto bindingIter{ InputBindingMap.find(bindingKey) };
+            assert(bindingIter != InputBindingMap.end());
+            bindingIter->second.IsDirty = true;
 
             InputValue bindingValue;
             GetInputValue(bindingKey, bindingValue);
@@ -123,15 +125,17 @@ namespace Rizityo::Input
     {
         assert(type < InputSource::Count);
         const uint64 key = GetKey(type, code);
-        value = InputValueMap[key];
+        const auto iter{ InputValueMap.find(key) };
+        value = (iter != InputValueMap.end()) ? iter->second : InputValue{};
     }
 
     void GetInputValue(uint64 bindingKey, OUT InputValue& value)
     {
-        if (!InputBindingMap.count(bindingKey))
+        const auto iter{ InputBindingMap.find(bindingKey) };
+        if (iter == InputBindingMap.end())
             return;
 
-        InputBinding& InputBinding{ InputBindingMap[bindingKey] };
+        InputBinding& InputBinding{ iter->second };
 
         if (!InputBinding.IsDirty)
         {
@@ -139,7 +143,7 @@ namespace Rizityo::Input
             return;
         }
 
-        Vector<InputSource>& sources{ InputBindingMap[bindingKey].Sources };
+        const Vector<InputSource>& sources{ InputBinding.Sources };
         InputValue subInputValue{};
         InputValue result{};
 
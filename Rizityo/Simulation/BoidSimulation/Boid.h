@@ -24,13 +24,20 @@ public:
 
 	void BeginPlay() override;
 
-	void Update(float32 dt) override;
+	// ̃GeBeBɂ܂Ȃ̂UpdateAll`NƂɕɌĂł悢
+	static constexpr bool ParallelUpdate = true;
 
+	// ^Ƃ̃v[ɒuAUpdatȇɂ܂Ƃ߂ČĂ΂
+	// BoidSimulation::UpdateŐi߂ԂTransformɏ
+	static void UpdateAll(Span<BoidScript> scripts, float32 dt);
+
+	// x(ȍ~̑xBoidSimulation)
 	[[nodiscard]] Math::Vector3 GetVerocity() const { return _Verocity; }
+	// BoidSimulation̏Ԃ̒ł̔ԍ(ƂɈxݒ肷)
+	void SetIndex(uint32 index) { _Index = index; }
 
 private:
 
 	Math::Vector3 _Verocity = { 1.f, 0.f, 0.f };
-	constexpr static float32 _MinSpeed = 2.f;
-	constexpr static float32 _MaxSpeed = 4.f;
+	uint32 _Index = UINT32_INVALID_NUM;
 };
\ No newline at end of file
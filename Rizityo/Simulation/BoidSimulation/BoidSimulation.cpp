@@ -1,4 +1,5 @@
 #include "Components/Entity.h"
+#include "Components/Query.h"
 #include "Components/Transform.h"
 #include "Components/Script.h"
 #include "Components/Render.h"
@@ -6,6 +7,7 @@
 #include "API/Light.h"
 #include "BoidSimulation.h"
 #include "Boid.h"
+#include "FlockKernel.h"
 
 using namespace Rizityo;
 
@@ -14,6 +16,8 @@ namespace
 	constexpr uint32 BoidXNum = 10;
 	constexpr uint32 BoidZNum = 10;
 	constexpr uint32 BoidNum = BoidXNum * BoidZNum;
+	constexpr float32 MinSpeed = 2.f;
+	constexpr float32 MaxSpeed = 4.f;
 
 	constexpr uint32 WallNum = 4;
 	constexpr float32 WallLeftX = -15.f;
@@ -41,9 +45,12 @@ namespace
 
 	// {Ch
 	GameEntity::Entity BoidEntities[BoidNum]{};
-	Math::Vector3 BoidPositions[BoidNum]{};
-	Math::Vector3 BoidVerocities[BoidNum]{};
-	std::unordered_map<ID::IDType, uint32> BoidEntityID_IndexMapping;
+	// Õt[̏Ԃǂłɏ݁AIւ
+	Boid::FlockBuffer FlockBuffers[2];
+	uint32 CurrentBuffer = 0;
+	Boid::FlockKernel Kernel;
+	Spatial::SpatialHash BoidGrid; // ߖTTp(t[蒼)
+	Math::Vector3 BoidPositions[BoidNum]{}; // ̈ʒu
 
 	float32 AlignementWeight = 1.f;
 	float32 CohesionWeight = 1.f;
@@ -110,11 +117,37 @@ namespace
 		{
 			for (uint32 j = 0; j < BoidZNum; j++)
 			{
-				const GameEntity::Entity entity = GameEntity::Spawn("Boid", { static_cast<float32>(i), 0.f, static_cast<float32>(j) });
-				BoidEntities[i * BoidZNum + j] = entity;
-				BoidEntityID_IndexMapping[entity.ID()] = i * BoidZNum + j;
+				BoidPositions[i * BoidZNum + j] = Math::Vector3{ static_cast<float32>(i), 0.f, static_cast<float32>(j) };
 			}
 		}
+
+		GameEntity::SpawnMany(&BoidInfo, BoidNum, &BoidPositions[0], nullptr, &BoidEntities[0]);
+
+		// ԂGeBeBW߂(ȍ~FlockBuffersƂȂ)
+		// TransformScript`NOǂ݁ABoidScript̂̂l߂ĕׂ(яJ[lindexɂȂ)
+		CurrentBuffer = 0;
+		Boid::FlockBuffer& state{ FlockBuffers[CurrentBuffer] };
+		state.Resize(BoidNum);
+		uint32 count = 0;
+		GameEntity::ForEach<Transform::Component, Script::Component>([&state, &count](Transform::Component& transform, Script::Component& scriptComponent)
+		{
+			BoidScript* const script{ scriptComponent.GetScript<BoidScript>() };
+			if (!script)
+				return;
+
+			assert(count < BoidNum);
+			const Math::Vector3 pos{ transform.GetPosition() };
+			const Math::Vector3 vel{ script->GetVerocity() };
+			script->SetIndex(count);
+			state.PosX[count] = pos.x;
+			state.PosY[count] = pos.y;
+			state.PosZ[count] = pos.z;
+			state.VelX[count] = vel.x;
+			state.VelY[count] = vel.y;
+			state.VelZ[count] = vel.z;
+			count++;
+		});
+		assert(count == BoidNum);
 	}
 
 	void RemoveBoids()
@@ -196,44 +229,14 @@ namespace Boid
 		return &BoidEntities[0];
 	}
 
-	const Math::Vector3* const GetBoidPositions()
-	{
-		return &BoidPositions[0];
-	}
-
-	const Math::Vector3* const GetBoidVerocities()
-	{
-		return &BoidVerocities[0];
-	}
-
-	uint32 GetEntityIndex(ID::IDType id)
-	{
-		return BoidEntityID_IndexMapping[id];
-	}
-
-	Math::Vector3 CalcWallForce(Math::Vector3 pos)
+	void GetState(uint32 index, OUT Math::Vector3& position, OUT Math::Vector3& verocity)
 	{
-		using namespace Math;
-		Vector3 force{ Vector3::ZERO };
-
-		if (pos.x - WallLeftX < WallDistance)
-			force += abs(pos.x - WallLeftX) * WallForceScale * Vector3::RIGHT;
-		if (WallRightX - pos.x < WallDistance)
-			force += -abs(WallRightX - pos.x) * WallForceScale * Vector3::RIGHT;
-		if (pos.z - WallBackZ < WallDistance)
-			force += abs(pos.z - WallBackZ) * WallForceScale * Vector3::FORWARD;
-		if (WallForwardZ - pos.z < WallDistance)
-			force += -abs(WallForwardZ - pos.z) * WallForceScale * Vector3::FORWARD;
-
-		return force;
+		const Boid::FlockBuffer& state{ FlockBuffers[CurrentBuffer] };
+		assert(index < state.Size());
+		position = Math::Vector3{ state.PosX[index], state.PosY[index], state.PosZ[index] };
+		verocity = Math::Vector3{ state.VelX[index], state.VelY[index], state.VelZ[index] };
 	}
 
-	float32 GetAlignement() { return AlignementWeight; }
-	float32 GetCohesion() { return CohesionWeight; }
-	float32 GetSeperation() { return SeperationWeight; }
-	float32 GetNeighborRadius() { return NeighborRadius; }
-	float32 GetSeperationRadius() { return SeperationRadius; }
-	float32 GetFOV() { return FOV; }
 	bool GetUpdateFlag() { return UpdateFlag; }
 }
 
@@ -245,13 +248,38 @@ void BoidSimulation::Initialize()
 	SimUI.SetFlag(true);
 }
 
-void BoidSimulation::Update()
+void BoidSimulation::Update(float32 dt)
 {
-	for (uint32 i = 0; i < BoidNum; i++)
-	{
-		BoidPositions[i] = BoidEntities[i].GetPosition();
-		BoidVerocities[i] = BoidEntities[i].GetScriptComponent().GetScript<BoidScript>()->GetVerocity();
-	}
+	if (!UpdateFlag)
+		return;
+
+	const Boid::FlockBuffer& current{ FlockBuffers[CurrentBuffer] };
+	Boid::FlockBuffer& next{ FlockBuffers[CurrentBuffer ^ 1] };
+
+	// ZTCYߐڗ̈̔aɍ킹邱ƂŋߖT3x3Z𒲂ׂ΂悢
+	const float32 cellSize = std::max(std::max(NeighborRadius, SeperationRadius), Math::EPSILON);
+	BoidGrid.Build(current.PosX.data(), current.PosY.data(), current.PosZ.data(), current.Size(), cellSize);
+
+	Boid::FlockParams params{};
+	params.AlignementWeight = AlignementWeight;
+	params.CohesionWeight = CohesionWeight;
+	params.SeperationWeight = SeperationWeight;
+	params.NeighborRadius = NeighborRadius;
+	params.SeperationRadius = SeperationRadius;
+	params.CosFOV = cosf(FOV * Math::PI / 180.f);
+	params.MinSpeed = MinSpeed;
+	params.MaxSpeed = MaxSpeed;
+	params.WallLeftX = WallLeftX;
+	params.WallRightX = WallRightX;
+	params.WallBackZ = WallBackZ;
+	params.WallForwardZ = WallForwardZ;
+	params.WallDistance = WallDistance;
+	params.WallForceScale = WallForceScale;
+
+	// S{ChSoÂ܂JobSystem̃[J[ŕSčXV
+	// Transformւ݂̏͑XNvg̍XVBoidScript::UpdateAlls
+	Kernel.Step(current, BoidGrid, params, dt, next, true);
+	CurrentBuffer ^= 1;
 }
 
 void BoidSimulation::Shutdown()
@@ -10,7 +10,7 @@ class BoidSimulation : public Simulation
 public:
 
 	void Initialize() override;
-	void Update() override;
+	void Update(float32 dt) override;
 	void Shutdown() override;
 };
 
@@ -18,18 +18,10 @@ namespace Boid
 {
 	uint32 GetBoidNum();
 	const GameEntity::Entity* const GetBoidEntity();
-	const Math::Vector3* const GetBoidPositions();
-	const Math::Vector3* const GetBoidVerocities();
-	uint32 GetEntityIndex(ID::IDType id);
-	
-	Math::Vector3 CalcWallForce(Math::Vector3 pos);
-
-	float32 GetAlignement();
-	float32 GetCohesion();
-	float32 GetSeperation();
-	float32 GetNeighborRadius();
-	float32 GetSeperationRadius();
-	float32 GetFOV();
+
+	// BoidSimulation::UpdateŌvZŐV̏
+	void GetState(uint32 index, OUT Math::Vector3& position, OUT Math::Vector3& verocity);
+
 	bool GetUpdateFlag();
 
 }
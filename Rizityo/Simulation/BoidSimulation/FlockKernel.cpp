@@ -0,0 +1,471 @@
+#include "FlockKernel.h"
+#include "Core/Utility/Math/SIMD.h"
+#include <limits>
+
+namespace Boid
+{
+	namespace
+	{
+		// ߖTTɎg1G[WFg̏
+		struct AgentQuery
+		{
+			float32 PosX, PosY, PosZ;
+			float32 DirX, DirY, DirZ; // Kx
+			float32 NeighborRadiusSquare;
+			float32 SeperationRadiusSquare;
+			float32 CosFOV;
+			uint32 Self; // gridł̃CfbNX(₩珜)
+		};
+
+		struct NeighborSum
+		{
+			float32 VelX = 0.f, VelY = 0.f, VelZ = 0.f;
+			float32 PosX = 0.f, PosY = 0.f, PosZ = 0.f;
+			float32 SepX = 0.f, SepY = 0.f, SepZ = 0.f;
+			float32 Count = 0.f;
+			float32 SepCount = 0.f;
+		};
+
+		struct SortedView
+		{
+			const float32* PosX;
+			const float32* PosY;
+			const float32* PosZ;
+			const float32* VelX;
+			const float32* VelY;
+			const float32* VelZ;
+		};
+
+		// ׂŽ1̘AzɏW߂
+		// oPbgƂ̌͐ȂAVX28[܂Ȃ̂ŁASZ܂Ƃ߂Ă画肷
+		// grid̏Ԃł͓Z̃G[WFĝŁAZ͈̔͂Ԃ͏WߒȂ
+		struct CandidateBuffer
+		{
+			Vector<float32> PosX, PosY, PosZ;
+			Vector<float32> VelX, VelY, VelZ;
+			Vector<uint32> Indices; // gridł̃CfbNX
+			uint32 Count = 0;
+			uint32 PaddedCount = 0; // 8̔{܂ŉ̓_Ŗ߂(AVX2Œ[ȂĂ悢)
+			Spatial::CellRange Range{};
+			bool IsValid = false; // grid蒼Wߒ
+
+			void Gather(const Spatial::SpatialHash& grid, const SortedView& v, const Spatial::CellRange& range)
+			{
+				constexpr uint32 MaxBuckets = 27;
+				uint32 begins[MaxBuckets], ends[MaxBuckets];
+				uint32 bucketCount = 0;
+				Count = 0;
+				grid.ForEachCell(range, [&](uint32 begin, uint32 end)
+				{
+					begins[bucketCount] = begin;
+					ends[bucketCount] = end;
+					bucketCount++;
+					Count += end - begin;
+				});
+
+				PaddedCount = (Count + 7) & ~7u;
+				if (PosX.size() < PaddedCount)
+				{
+					PosX.resize(PaddedCount);
+					PosY.resize(PaddedCount);
+					PosZ.resize(PaddedCount);
+					VelX.resize(PaddedCount);
+					VelY.resize(PaddedCount);
+					VelZ.resize(PaddedCount);
+					Indices.resize(PaddedCount);
+				}
+
+				uint32 offset = 0;
+				for (uint32 i = 0; i < bucketCount; i++)
+				{
+					const uint32 begin = begins[i];
+					const uint32 size = ends[i] - begin;
+					memcpy(&PosX[offset], v.PosX + begin, size * sizeof(float32));
+					memcpy(&PosY[offset], v.PosY + begin, size * sizeof(float32));
+					memcpy(&PosZ[offset], v.PosZ + begin, size * sizeof(float32));
+					memcpy(&VelX[offset], v.VelX + begin, size * sizeof(float32));
+					memcpy(&VelY[offset], v.VelY + begin, size * sizeof(float32));
+					memcpy(&VelZ[offset], v.VelZ + begin, size * sizeof(float32));
+					for (uint32 k = 0; k < size; k++)
+					{
+						Indices[offset + k] = begin + k;
+					}
+					offset += size;
+				}
+
+				// 2悪ɂȂĔaOƔ肳_Ŗ߂
+				for (uint32 k = Count; k < PaddedCount; k++)
+				{
+					PosX[k] = PosY[k] = PosZ[k] = std::numeric_limits<float32>::max();
+					VelX[k] = VelY[k] = VelZ[k] = 0.f;
+					Indices[k] = UINT32_INVALID_NUM;
+				}
+
+				Range = range;
+				IsValid = true;
+			}
+		};
+
+		// [J[ƂɎg܂킷
+		thread_local CandidateBuffer Candidates;
+
+		void AccumulateScalar(const CandidateBuffer& c, const AgentQuery& q, NeighborSum& sum)
+		{
+			for (uint32 k = 0; k < c.Count; k++)
+			{
+				if (c.Indices[k] == q.Self)
+					continue;
+
+				const float32 dx = c.PosX[k] - q.PosX;
+				const float32 dy = c.PosY[k] - q.PosY;
+				const float32 dz = c.PosZ[k] - q.PosZ;
+				const float32 distSquare = dx * dx + dy * dy + dz * dz;
+
+				// ߐڗ̈l
+				if (distSquare > q.NeighborRadiusSquare)
+					continue;
+
+				// EɓĂ̂l(dir𐳋Kɋ|Ĕׂ)
+				if (dx * q.DirX + dy * q.DirY + dz * q.DirZ < q.CosFOV * sqrtf(distSquare))
+					continue;
+
+				sum.Count += 1.f;
+				sum.VelX += c.VelX[k];
+				sum.VelY += c.VelY[k];
+				sum.VelZ += c.VelZ[k];
+				sum.PosX += c.PosX[k];
+				sum.PosY += c.PosY[k];
+				sum.PosZ += c.PosZ[k];
+
+				if (distSquare > q.SeperationRadiusSquare)
+					continue;
+
+				sum.SepCount += 1.f;
+				sum.SepX += c.PosX[k];
+				sum.SepY += c.PosY[k];
+				sum.SepZ += c.PosZ[k];
+			}
+		}
+
+#if USE_AVX2
+		using Math::SIMD::HorizontalSum;
+
+		// 8܂Ƃ߂Ĕ肷(8̔{܂Ŗ߂Ă̂Œ[͂Ȃ)
+		AVX2_FUNCTION void AccumulateAVX2(const CandidateBuffer& c, const AgentQuery& q, NeighborSum& sum)
+		{
+			const __m256 px = _mm256_set1_ps(q.PosX);
+			const __m256 py = _mm256_set1_ps(q.PosY);
+			const __m256 pz = _mm256_set1_ps(q.PosZ);
+			const __m256 dirX = _mm256_set1_ps(q.DirX);
+			const __m256 dirY = _mm256_set1_ps(q.DirY);
+			const __m256 dirZ = _mm256_set1_ps(q.DirZ);
+			const __m256 r2 = _mm256_set1_ps(q.NeighborRadiusSquare);
+			const __m256 s2 = _mm256_set1_ps(q.SeperationRadiusSquare);
+			const __m256 cosFOV = _mm256_set1_ps(q.CosFOV);
+			const __m256i self = _mm256_set1_epi32((int32)q.Self);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 one = _mm256_set1_ps(1.f);
+
+			__m256 count = zero, velX = zero, velY = zero, velZ = zero, posX = zero, posY = zero, posZ = zero;
+			__m256 sepCount = zero, sepX = zero, sepY = zero, sepZ = zero;
+			__m256 found = zero; // ߖTƂ݂Ȃ[
+
+			for (uint32 k = 0; k < c.PaddedCount; k += 8)
+			{
+				const __m256 ox = _mm256_loadu_ps(c.PosX.data() + k);
+				const __m256 oy = _mm256_loadu_ps(c.PosY.data() + k);
+				const __m256 oz = _mm256_loadu_ps(c.PosZ.data() + k);
+				const __m256 dx = _mm256_sub_ps(ox, px);
+				const __m256 dy = _mm256_sub_ps(oy, py);
+				const __m256 dz = _mm256_sub_ps(oz, pz);
+				const __m256 distSquare = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+				const __m256 dot = _mm256_fmadd_ps(dx, dirX, _mm256_fmadd_ps(dy, dirY, _mm256_mul_ps(dz, dirZ)));
+				const __m256 isSelf = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(c.Indices.data() + k)), self));
+
+				__m256 mask = _mm256_andnot_ps(isSelf, _mm256_cmp_ps(distSquare, r2, _CMP_LE_OQ));
+				mask = _mm256_and_ps(mask, _mm256_cmp_ps(dot, _mm256_mul_ps(cosFOV, _mm256_sqrt_ps(distSquare)), _CMP_GE_OQ));
+				if (_mm256_testz_ps(mask, mask))
+					continue;
+
+				found = _mm256_or_ps(found, mask);
+				count = _mm256_add_ps(count, _mm256_and_ps(mask, one));
+				velX = _mm256_add_ps(velX, _mm256_and_ps(mask, _mm256_loadu_ps(c.VelX.data() + k)));
+				velY = _mm256_add_ps(velY, _mm256_and_ps(mask, _mm256_loadu_ps(c.VelY.data() + k)));
+				velZ = _mm256_add_ps(velZ, _mm256_and_ps(mask, _mm256_loadu_ps(c.VelZ.data() + k)));
+				posX = _mm256_add_ps(posX, _mm256_and_ps(mask, ox));
+				posY = _mm256_add_ps(posY, _mm256_and_ps(mask, oy));
+				posZ = _mm256_add_ps(posZ, _mm256_and_ps(mask, oz));
+
+				const __m256 sepMask = _mm256_and_ps(mask, _mm256_cmp_ps(distSquare, s2, _CMP_LE_OQ));
+				sepCount = _mm256_add_ps(sepCount, _mm256_and_ps(sepMask, one));
+				sepX = _mm256_add_ps(sepX, _mm256_and_ps(sepMask, ox));
+				sepY = _mm256_add_ps(sepY, _mm256_and_ps(sepMask, oy));
+				sepZ = _mm256_add_ps(sepZ, _mm256_and_ps(sepMask, oz));
+			}
+
+			// ߖTΐZȂ(قƂǂ̃G[WFg͋ߖT1ȉ)
+			if (_mm256_testz_ps(found, found))
+				return;
+
+			sum.Count += HorizontalSum(count);
+			sum.VelX += HorizontalSum(velX);
+			sum.VelY += HorizontalSum(velY);
+			sum.VelZ += HorizontalSum(velZ);
+			sum.PosX += HorizontalSum(posX);
+			sum.PosY += HorizontalSum(posY);
+			sum.PosZ += HorizontalSum(posZ);
+			sum.SepCount += HorizontalSum(sepCount);
+			sum.SepX += HorizontalSum(sepX);
+			sum.SepY += HorizontalSum(sepY);
+			sum.SepZ += HorizontalSum(sepZ);
+		}
+#endif // USE_AVX2
+
+		void IntegrateScalar(const FlockBuffer& src, const float32* ax, const float32* ay, const float32* az, const FlockParams& p, float32 dt,
+							 uint32 begin, uint32 end, OUT FlockBuffer& dst)
+		{
+			for (uint32 i = begin; i < end; i++)
+			{
+				const float32 px = src.PosX[i], py = src.PosY[i], pz = src.PosZ[i];
+
+				// ǂ
+				float32 fx = 0.f, fz = 0.f;
+				if (px - p.WallLeftX < p.WallDistance)
+					fx += fabsf(px - p.WallLeftX) * p.WallForceScale;
+				if (p.WallRightX - px < p.WallDistance)
+					fx -= fabsf(p.WallRightX - px) * p.WallForceScale;
+				if (pz - p.WallBackZ < p.WallDistance)
+					fz += fabsf(pz - p.WallBackZ) * p.WallForceScale;
+				if (p.WallForwardZ - pz < p.WallDistance)
+					fz -= fabsf(p.WallForwardZ - pz) * p.WallForceScale;
+
+				float32 vx = src.VelX[i] + (ax[i] + fx) * dt;
+				float32 vy = src.VelY[i] + ay[i] * dt;
+				float32 vz = src.VelZ[i] + (az[i] + fz) * dt;
+
+				// [MinSpeed, MaxSpeed]Ɏ߂
+				const float32 length = sqrtf(vx * vx + vy * vy + vz * vz);
+				const float32 scale = (length > 0.f) ? Math::Clamp(length, p.MinSpeed, p.MaxSpeed) / length : 0.f;
+				vx *= scale;
+				vy *= scale;
+				vz *= scale;
+
+				dst.VelX[i] = vx;
+				dst.VelY[i] = vy;
+				dst.VelZ[i] = vz;
+				dst.PosX[i] = px + vx * dt;
+				dst.PosY[i] = py + vy * dt;
+				dst.PosZ[i] = pz + vz * dt;
+			}
+		}
+
+#if USE_AVX2
+		// 8G[WFg܂Ƃ߂Đϕ
+		AVX2_FUNCTION void IntegrateAVX2(const FlockBuffer& src, const float32* ax, const float32* ay, const float32* az, const FlockParams& p, float32 dt,
+										 uint32 begin, uint32 end, OUT FlockBuffer& dst)
+		{
+			const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 deltaTime = _mm256_set1_ps(dt);
+			const __m256 wallLeft = _mm256_set1_ps(p.WallLeftX);
+			const __m256 wallRight = _mm256_set1_ps(p.WallRightX);
+			const __m256 wallBack = _mm256_set1_ps(p.WallBackZ);
+			const __m256 wallForward = _mm256_set1_ps(p.WallForwardZ);
+			const __m256 wallDistance = _mm256_set1_ps(p.WallDistance);
+			const __m256 wallScale = _mm256_set1_ps(p.WallForceScale);
+			const __m256 minSpeed = _mm256_set1_ps(p.MinSpeed);
+			const __m256 maxSpeed = _mm256_set1_ps(p.MaxSpeed);
+
+			uint32 i = begin;
+			for (; i + 8 <= end; i += 8)
+			{
+				const __m256 px = _mm256_loadu_ps(src.PosX.data() + i);
+				const __m256 py = _mm256_loadu_ps(src.PosY.data() + i);
+				const __m256 pz = _mm256_loadu_ps(src.PosZ.data() + i);
+
+				// ǂ
+				const __m256 left = _mm256_sub_ps(px, wallLeft);
+				const __m256 right = _mm256_sub_ps(wallRight, px);
+				const __m256 back = _mm256_sub_ps(pz, wallBack);
+				const __m256 forward = _mm256_sub_ps(wallForward, pz);
+				__m256 fx = _mm256_and_ps(_mm256_cmp_ps(left, wallDistance, _CMP_LT_OQ), _mm256_mul_ps(_mm256_and_ps(left, absMask), wallScale));
+				fx = _mm256_sub_ps(fx, _mm256_and_ps(_mm256_cmp_ps(right, wallDistance, _CMP_LT_OQ), _mm256_mul_ps(_mm256_and_ps(right, absMask), wallScale)));
+				__m256 fz = _mm256_and_ps(_mm256_cmp_ps(back, wallDistance, _CMP_LT_OQ), _mm256_mul_ps(_mm256_and_ps(back, absMask), wallScale));
+				fz = _mm256_sub_ps(fz, _mm256_and_ps(_mm256_cmp_ps(forward, wallDistance, _CMP_LT_OQ), _mm256_mul_ps(_mm256_and_ps(forward, absMask), wallScale)));
+
+				__m256 vx = _mm256_fmadd_ps(_mm256_add_ps(_mm256_loadu_ps(ax + i), fx), deltaTime, _mm256_loadu_ps(src.VelX.data() + i));
+				__m256 vy = _mm256_fmadd_ps(_mm256_loadu_ps(ay + i), deltaTime, _mm256_loadu_ps(src.VelY.data() + i));
+				__m256 vz = _mm256_fmadd_ps(_mm256_add_ps(_mm256_loadu_ps(az + i), fz), deltaTime, _mm256_loadu_ps(src.VelZ.data() + i));
+
+				// [MinSpeed, MaxSpeed]Ɏ߂(0̏ꍇ0̂܂)
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz))));
+				const __m256 speed = _mm256_min_ps(_mm256_max_ps(length, minSpeed), maxSpeed);
+				const __m256 scale = _mm256_and_ps(_mm256_cmp_ps(length, zero, _CMP_GT_OQ), _mm256_div_ps(speed, length));
+				vx = _mm256_mul_ps(vx, scale);
+				vy = _mm256_mul_ps(vy, scale);
+				vz = _mm256_mul_ps(vz, scale);
+
+				_mm256_storeu_ps(dst.VelX.data() + i, vx);
+				_mm256_storeu_ps(dst.VelY.data() + i, vy);
+				_mm256_storeu_ps(dst.VelZ.data() + i, vz);
+				_mm256_storeu_ps(dst.PosX.data() + i, _mm256_fmadd_ps(vx, deltaTime, px));
+				_mm256_storeu_ps(dst.PosY.data() + i, _mm256_fmadd_ps(vy, deltaTime, py));
+				_mm256_storeu_ps(dst.PosZ.data() + i, _mm256_fmadd_ps(vz, deltaTime, pz));
+			}
+
+			// ]̓XJ[ŏ
+			IntegrateScalar(src, ax, ay, az, p, dt, i, end, dst);
+		}
+#endif // USE_AVX2
+	}
+
+	void FlockKernel::Step(const FlockBuffer& src, const Spatial::SpatialHash& grid, const FlockParams& params, float32 dt, OUT FlockBuffer& dst,
+						   bool parallel)
+	{
+		assert(&src != &dst);
+		const uint32 count = src.Size();
+		assert(grid.Count() == count);
+		assert(params.NeighborRadius <= grid.CellSize());
+
+		dst.Resize(count);
+		_SortedVelX.resize(count);
+		_SortedVelY.resize(count);
+		_SortedVelZ.resize(count);
+		_AccelX.resize(count);
+		_AccelY.resize(count);
+		_AccelZ.resize(count);
+		_ChunkStats.resize((count + ChunkSize - 1) / ChunkSize);
+
+		// `N̋E̓Xbhɂ炸ŒȂ̂ŁAǂ̃XbhłʂɂȂ
+		const auto forEachChunk = [parallel, count](auto&& func)
+		{
+			if (parallel)
+			{
+				Thread::JobSystem::ParallelFor(count, ChunkSize, func);
+				return;
+			}
+			for (uint32 begin = 0; begin < count; begin += ChunkSize)
+			{
+				func(begin, std::min(begin + ChunkSize, count));
+			}
+		};
+
+		// xgridƓԂɕׂċߖT͈̔͂AƂēǂ߂悤ɂ
+		const uint32* const sortedIndices{ grid.SortedIndices() };
+		forEachChunk([&](uint32 begin, uint32 end)
+		{
+			for (uint32 k = begin; k < end; k++)
+			{
+				const uint32 i = sortedIndices[k];
+				_SortedVelX[k] = src.VelX[i];
+				_SortedVelY[k] = src.VelY[i];
+				_SortedVelZ[k] = src.VelZ[i];
+			}
+		});
+
+		const SortedView view{ grid.SortedX(), grid.SortedY(), grid.SortedZ(), _SortedVelX.data(), _SortedVelY.data(), _SortedVelZ.data() };
+#if USE_AVX2
+		const bool useAVX2 = Math::SIMD::IsAVX2Supported();
+#else
+		constexpr bool useAVX2 = false;
+#endif
+
+		// ߖT琮EEɂx߂
+		// grid̏ԂŏƗׂ荇G[WFgZǂނ̂ŃLbVɏ₷
+		// eG[WFg͑ȌԂǂŎ̉xȂ̂ŁA`NԂŏ݂dȂȂ
+		forEachChunk([&](uint32 chunkBegin, uint32 chunkEnd)
+		{
+			Spatial::QueryStats stats{};
+			CandidateBuffer& candidates{ Candidates };
+			candidates.IsValid = false;
+			for (uint32 k = chunkBegin; k < chunkEnd; k++)
+			{
+				const uint32 i = sortedIndices[k];
+
+				AgentQuery q{};
+				q.PosX = view.PosX[k];
+				q.PosY = view.PosY[k];
+				q.PosZ = view.PosZ[k];
+				const float32 length = sqrtf(src.VelX[i] * src.VelX[i] + src.VelY[i] * src.VelY[i] + src.VelZ[i] * src.VelZ[i]);
+				const float32 invLength = (length > 0.f) ? 1.f / length : 0.f;
+				q.DirX = src.VelX[i] * invLength;
+				q.DirY = src.VelY[i] * invLength;
+				q.DirZ = src.VelZ[i] * invLength;
+				q.NeighborRadiusSquare = params.NeighborRadius * params.NeighborRadius;
+				q.SeperationRadiusSquare = params.SeperationRadius * params.SeperationRadius;
+				q.CosFOV = params.CosFOV;
+				q.Self = k;
+
+				const Spatial::CellRange range{ grid.GetCellRange(q.PosX, q.PosY, q.PosZ, params.NeighborRadius) };
+				if (!candidates.IsValid || candidates.Range != range)
+				{
+					candidates.Gather(grid, view, range);
+				}
+				stats.CandidateCount += candidates.Count;
+
+				NeighborSum sum{};
+#if USE_AVX2
+				if (useAVX2)
+				{
+					AccumulateAVX2(candidates, q, sum);
+				}
+				else
+#endif
+				{
+					AccumulateScalar(candidates, q, sum);
+				}
+
+				stats.NeighborCount += (uint64)sum.Count;
+
+				float32 accelX = 0.f, accelY = 0.f, accelZ = 0.f;
+				if (sum.Count > 0.f)
+				{
+					const float32 inv = 1.f / sum.Count;
+					// 
+					accelX += (sum.PosX * inv - q.PosX) * params.CohesionWeight;
+					accelY += (sum.PosY * inv - q.PosY) * params.CohesionWeight;
+					accelZ += (sum.PosZ * inv - q.PosZ) * params.CohesionWeight;
+					// 
+					accelX += (sum.VelX * inv - src.VelX[i]) * params.AlignementWeight;
+					accelY += (sum.VelY * inv - src.VelY[i]) * params.AlignementWeight;
+					accelZ += (sum.VelZ * inv - src.VelZ[i]) * params.AlignementWeight;
+				}
+
+				if (sum.SepCount > 0.f)
+				{
+					// 
+					const float32 inv = 1.f / sum.SepCount;
+					accelX -= (sum.SepX * inv - q.PosX) * params.SeperationWeight;
+					accelY -= (sum.SepY * inv - q.PosY) * params.SeperationWeight;
+					accelZ -= (sum.SepZ * inv - q.PosZ) * params.SeperationWeight;
+				}
+
+				_AccelX[i] = accelX;
+				_AccelY[i] = accelY;
+				_AccelZ[i] = accelZ;
+			}
+			stats.QueryCount = chunkEnd - chunkBegin;
+			_ChunkStats[chunkBegin / ChunkSize] = stats;
+		});
+
+		_Stats = {};
+		for (const Spatial::QueryStats& stats : _ChunkStats)
+		{
+			_Stats += stats;
+		}
+
+		// ǂ͂đxƈʒuXV
+		// ChunkSize8̔{Ȃ̂ŁAAVX2ƃXJ[̂ǂŏ邩XbhɂȂ
+		forEachChunk([&](uint32 begin, uint32 end)
+		{
+#if USE_AVX2
+			if (useAVX2)
+			{
+				IntegrateAVX2(src, _AccelX.data(), _AccelY.data(), _AccelZ.data(), params, dt, begin, end, dst);
+				return;
+			}
+#endif
+			IntegrateScalar(src, _AccelX.data(), _AccelY.data(), _AccelZ.data(), params, dt, begin, end, dst);
+		});
+	}
+}
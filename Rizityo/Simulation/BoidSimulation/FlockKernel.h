@@ -0,0 +1,87 @@
+#pragma once
+#include "CommonHeaders.h"
+#include "Core/Utility/Spatial/SpatialHash.h"
+#include "Core/Utility/Thread/JobSystem.h"
+
+using namespace Rizityo;
+
+namespace Boid
+{
+	struct FlockParams
+	{
+		float32 AlignementWeight;
+		float32 CohesionWeight;
+		float32 SeperationWeight;
+		float32 NeighborRadius;
+		float32 SeperationRadius;
+		float32 CosFOV; // p̔p̃RTC
+		float32 MinSpeed;
+		float32 MaxSpeed;
+
+		// 
+		float32 WallLeftX;
+		float32 WallRightX;
+		float32 WallBackZ;
+		float32 WallForwardZ;
+		float32 WallDistance;
+		float32 WallForceScale;
+	};
+
+	// {Ch̏Ԃ𐬕Ƃ̔z(SoA)Ŏ
+	struct FlockBuffer
+	{
+		Vector<float32> PosX;
+		Vector<float32> PosY;
+		Vector<float32> PosZ;
+		Vector<float32> VelX;
+		Vector<float32> VelY;
+		Vector<float32> VelZ;
+
+		void Resize(uint32 count)
+		{
+			PosX.resize(count);
+			PosY.resize(count);
+			PosZ.resize(count);
+			VelX.resize(count);
+			VelY.resize(count);
+			VelZ.resize(count);
+		}
+
+		[[nodiscard]] uint32 Size() const { return (uint32)PosX.size(); }
+	};
+
+	// EEƕǂ͂vZ1Xebvi߂
+	// AVX2gꍇ8vf܂Ƃ߂ČvZ
+	class FlockKernel
+	{
+	public:
+
+		// ɏP(AVX28vf̂8̔{ɂ)
+		static constexpr uint32 ChunkSize = 256;
+		static_assert(ChunkSize % 8 == 0);
+
+		// srcǂdstɏȂ̂ŁAsrcdst͕ʂ̃obt@ɂ邱
+		// gridsrc̈ʒuĂKv
+		// paralleltrueȂChunkSizeƂJobSystemŕɏ(ʂ̓XbhɂȂ)
+		void Step(const FlockBuffer& src, const Spatial::SpatialHash& grid, const FlockParams& params, float32 dt, OUT FlockBuffer& dst,
+				  bool parallel = false);
+
+		// OStepł̋ߖTT̓v
+		[[nodiscard]] const Spatial::QueryStats& Stats() const { return _Stats; }
+
+	private:
+
+		// gridƓԂɕׂx
+		Vector<float32> _SortedVelX;
+		Vector<float32> _SortedVelY;
+		Vector<float32> _SortedVelZ;
+
+		// ߖT狁߂x(ǂ̗͂͊܂܂Ȃ)
+		Vector<float32> _AccelX;
+		Vector<float32> _AccelY;
+		Vector<float32> _AccelZ;
+
+		Vector<Spatial::QueryStats> _ChunkStats;
+		Spatial::QueryStats _Stats;
+	};
+}
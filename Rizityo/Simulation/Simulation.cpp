@@ -1,9 +1,11 @@
 #include "BoidSimulation/BoidSimulation.h"
 #include "SynchroSimulation/SynchroSimulation.h"
 #include "Core/Platform/PlatformWindow/PlatformWindow.h"
-#include "Core/Utility/Time/Timer.h"
+#include "Core/Utility/Time/FrameScheduler.h"
 #include "Core/Utility/IO/FileIO.h"
+#include "Core/Utility/Thread/JobSystem.h"
 #include "Graphics/Renderer.h"
+#include "Graphics/RenderThread.h"
 #include "Components/Entity.h"
 #include "Components/Transform.h"
 #include "Components/Script.h"
@@ -17,7 +19,7 @@ using namespace Rizityo;
 
 namespace
 {
-	Time::Timer GameTimer{};
+	Time::FrameScheduler Scheduler{};
 
 	struct SimulationWindow
 	{
@@ -105,6 +107,8 @@ namespace
 			Platform::Window win{ Platform::WindowID{(ID::IDType)GetWindowLongPtr(hwnd,GWLP_USERDATA)} };
 			if (win.ID() == Window.Surface.Window.ID())
 			{
+				// `撆̃T[tFXƃJύXȂ悤ɑ҂
+				Graphics::RenderThread::Flush();
 				if (toggleFullscreen)
 				{
 					win.SetFullScreen(!win.IsFullScreen());
@@ -151,6 +155,7 @@ namespace
 
 	void DestroyGameWindow()
 	{
+		Graphics::RenderThread::Flush();
 		SimulationWindow win{ Window };
 		Window = {};
 		if (win.Surface.Surface.IsValid())
@@ -173,10 +178,12 @@ namespace
 
 	void RenderWindow()
 	{
-		Graphics::FrameInfo info{};
-		Render::GetRenderFrameInfo(info);
-		info.CamerID = Window.Camera.ID();
-		Window.Surface.Surface.Render(info);
+		// `Xbh͑Õt[`悵ĂrȂ̂ŁA`XbhǂłȂpPbgɏœn
+		Graphics::FramePacket& packet{ Graphics::RenderThread::BeginPacket() };
+		Render::GetRenderFramePacket(packet);
+		packet.Surface = Window.Surface.Surface.ID();
+		packet.CamerID = Window.Camera.ID();
+		Graphics::RenderThread::Submit();
 	}
 
 	void BindInput()
@@ -247,22 +254,30 @@ namespace
 
 bool Initialize()
 {
-	auto _ls = std::thread{ [] { LoadShader(); } };
+	Thread::JobSystem::Initialize();
 
-	if (!Graphics::Initialize(Graphics::GraphicsPlatform::Direct3D12))
-		return false;
+	Thread::JobCounter shaderCounter;
+	Thread::JobSystem::Run([] { LoadShader(); }, &shaderCounter);
+
+	const bool graphicsInitialized = Graphics::Initialize(Graphics::GraphicsPlatform::Direct3D12);
+	if (graphicsInitialized)
+	{
+		CreateGameWindow();
 
-	CreateGameWindow();
+		BindInput();
 
-	BindInput();
+		Graphics::RenderThread::Initialize();
+	}
 
-	_ls.join();
+	Thread::JobSystem::Wait(&shaderCounter);
+	if (!graphicsInitialized)
+		return false;
 
 	Sim = &BoidSim;
 	//Sim = &SyncSim;
 	Sim->Initialize();
 
-	GameTimer.Reset();
+	Scheduler.Reset();
 
 	IsRestarting = false;
 	SimCooling = false;
@@ -273,9 +288,9 @@ bool Initialize()
 
 void Update()
 {
-	GameTimer.Tick();
+	const uint32 stepCount = Scheduler.BeginFrame();
 
-	float32 delta = GameTimer.DeltaTime();
+	float32 delta = Scheduler.FrameDeltaTime();
 
 	if (SimCooling)
 	{
@@ -293,6 +308,7 @@ void Update()
 	{
 		if (Input::GetKeyDown(Input::InputCode::Key1))
 		{
+			Graphics::RenderThread::Flush();
 			Sim->Shutdown();
 			Sim = &BoidSim;
 			Sim->Initialize();
@@ -300,6 +316,7 @@ void Update()
 		}
 		else if (Input::GetKeyDown(Input::InputCode::Key2))
 		{
+			Graphics::RenderThread::Flush();
 			Sim->Shutdown();
 			Sim = &SyncSim;
 			Sim->Initialize();
@@ -307,14 +324,22 @@ void Update()
 		}
 	}
 
-	// TODO : Œt[[gɂ邩
-	//		  Œt[[g̏ꍇ^C}[̎Ԃ͌Œt[̎Ԃ҂Ԃ̂Ȃׂ̂
-	//		  ҂Ԃꍇ̓^C}[Xgbvsleep_for̈ςKv
-	std::this_thread::sleep_for(std::chrono::milliseconds(16));
-
-	Sim->Update();
+	Thread::JobSystem::ExecuteMainThreadJobs();
 	GUI::Update(delta);
-	Script::Update(delta);
+
+	// V~[VƃXNvg͌Œ莞ԂŐi߁A`̓Xebv̊ԂԂ
+	const float32 fixedDelta = Scheduler.FixedDeltaTime();
+	for (uint32 i = 0; i < stepCount; i++)
+	{
+		Transform::BeginFixedStep();
+		Sim->Update(fixedDelta);
+		Script::Update(fixedDelta);
+
+		// XNvg̍XVɋL^E폜܂Ƃ߂Ďs
+		GameEntity::ApplyCommands();
+	}
+	Transform::SetInterpolationAlpha(Scheduler.InterpolationAlpha());
+	Transform::UpdateTransformMatrices();
 
 	// Render::Update();
 
@@ -323,10 +348,14 @@ void Update()
 		RenderWindow();
 	}
 
+	Scheduler.WaitForNextFrame();
 }
 
 void Shutdown()
 {
+	// `撆̃t[`IĂGeBeB⃊\[X폜
+	Graphics::RenderThread::Shutdown();
+
 	Sim->Shutdown();
 
 	DestroyGameWindow();
@@ -336,4 +365,6 @@ void Shutdown()
 	UnloadShader();
 
 	Graphics::Shutdown();
+
+	Thread::JobSystem::Shutdown();
 }
\ No newline at end of file
@@ -5,6 +5,6 @@ class Simulation
 {
 public:
 	virtual void Initialize() = 0;
-	virtual void Update() = 0;
+	virtual void Update(float dt) = 0;
 	virtual void Shutdown() = 0;
 };
\ No newline at end of file
@@ -1,6 +1,5 @@
 #pragma once
 #include "API/GameEntity.h"
-#include <random>
 
 using namespace Rizityo;
 
@@ -8,29 +7,21 @@ class OscillatorScript : public Script::EntityScript
 {
 public:
 
-	explicit OscillatorScript(GameEntity::Entity entity) : Script::EntityScript(entity)
-	{
-		static std::uniform_real_distribution<float32> dist(0.f, Math::TWO_PI);
-
-		_DirAngle = dist(_Gen);
-		_AngularFreq = dist(_Gen) / 4;
-		_Phase = dist(_Gen);
-	}
+	explicit OscillatorScript(GameEntity::Entity entity) : Script::EntityScript(entity) {}
 
 	void BeginPlay() override;
 
-	void Update(float32 dt) override;
-
-	[[nodiscard]] constexpr float32 GetPhase() const { return _Phase; }
+	// ̃GeBeBɂ܂Ȃ̂UpdateAll`NƂɕɌĂł悢
+	static constexpr bool ParallelUpdate = true;
 
-private:
+	// ^Ƃ̃v[ɒuAUpdatȇɂ܂Ƃ߂ČĂ΂
+	// SynchroSimulation::UpdateŐi߂ԂTransformɏ
+	static void UpdateAll(Span<OscillatorScript> scripts, float32 dt);
 
-	float32 _DirAngle = 0.f;
+	// SynchroSimulation̏Ԃ̒ł̔ԍ(ƂɈxݒ肷)
+	void SetIndex(uint32 index) { _Index = index; }
 
-	float32 _Phase = 0.f;
-	float32 _AngularFreq = Math::HALF_PI / 2;
-
-	static inline std::random_device _RD{};
-	static inline std::mt19937 _Gen{_RD()};
+private:
 
+	uint32 _Index = UINT32_INVALID_NUM;
 };
\ No newline at end of file
@@ -0,0 +1,402 @@
+#include "OscillatorKernel.h"
+#include "Core/Utility/Math/SIMD.h"
+#include <limits>
+
+namespace Oscillator
+{
+	namespace
+	{
+		// [0, /2]łsin9̋ߎ̌W(x, x^3, ..., x^9)
+		// ͈͂܂ԂĎĝ|x| <= 4΂ł̍ő덷͖4e-7
+		constexpr float32 SinCoef1 = 1.f;
+		constexpr float32 SinCoef3 = -0.166666597f;
+		constexpr float32 SinCoef5 = 0.00833307858f;
+		constexpr float32 SinCoef7 = -0.000198106907f;
+		constexpr float32 SinCoef9 = 2.60831598e-6f;
+		constexpr float32 InvTwoPI = 1.f / Math::TWO_PI;
+
+		// ŋߎsin(ʑ̂悤|x|ȓ̒lz)
+		float32 FastSin(float32 x)
+		{
+			// [-, ]Ɏ߂ĂAsin(x) = sin( - x)[0, /2]ɐ܂Ԃ
+			const float32 r = x - nearbyintf(x * InvTwoPI) * Math::TWO_PI;
+			float32 a = fabsf(r);
+			a = std::min(a, Math::PI - a);
+			const float32 a2 = a * a;
+			const float32 y = a * (SinCoef1 + a2 * (SinCoef3 + a2 * (SinCoef5 + a2 * (SinCoef7 + a2 * SinCoef9))));
+			return copysignf(y, r);
+		}
+
+		float32 FastCos(float32 x)
+		{
+			return FastSin(x + Math::HALF_PI);
+		}
+
+		struct SortedView
+		{
+			const float32* PosX;
+			const float32* PosY;
+			const float32* PosZ;
+			const float32* Phase;
+		};
+
+		// ߖTTɎg1IV[^[̏
+		struct CouplingQuery
+		{
+			float32 PosX, PosY, PosZ;
+			float32 Phase;
+			uint32 Self; // g̃\[gςݔzł̃CfbNX
+			float32 RadiusSquare;
+			float32 Weight;
+			// Ōꍇ̏d݂Weight * (1 - d^2 / r^2)
+			float32 DistanceScale; // ꍇWeight / r^2AȂꍇ0
+		};
+
+		struct CouplingSum
+		{
+			float32 Total = 0.f;
+			uint64 NeighborCount = 0;
+		};
+
+		// ׂŽ1̘AzɏW߂(FlockKernelƓRŃoPbgƂɂ͔肵Ȃ)
+		// grid̏Ԃł͓Z̃IV[^[̂ŁAZ͈̔͂Ԃ͏WߒȂ
+		struct CandidateBuffer
+		{
+			Vector<float32> PosX, PosY, PosZ;
+			Vector<float32> Phase;
+			Vector<uint32> Indices; // gridł̃CfbNX
+			uint32 Count = 0;
+			uint32 PaddedCount = 0; // 8̔{܂ŉ̓_Ŗ߂
+			Spatial::CellRange Range{};
+			bool IsValid = false; // grid蒼Wߒ
+
+			void Gather(const Spatial::SpatialHash& grid, const SortedView& v, const Spatial::CellRange& range)
+			{
+				constexpr uint32 MaxBuckets = 27;
+				uint32 begins[MaxBuckets], ends[MaxBuckets];
+				uint32 bucketCount = 0;
+				Count = 0;
+				grid.ForEachCell(range, [&](uint32 begin, uint32 end)
+				{
+					begins[bucketCount] = begin;
+					ends[bucketCount] = end;
+					bucketCount++;
+					Count += end - begin;
+				});
+
+				PaddedCount = (Count + 7) & ~7u;
+				if (PosX.size() < PaddedCount)
+				{
+					PosX.resize(PaddedCount);
+					PosY.resize(PaddedCount);
+					PosZ.resize(PaddedCount);
+					Phase.resize(PaddedCount);
+					Indices.resize(PaddedCount);
+				}
+
+				uint32 offset = 0;
+				for (uint32 i = 0; i < bucketCount; i++)
+				{
+					const uint32 begin = begins[i];
+					const uint32 size = ends[i] - begin;
+					memcpy(&PosX[offset], v.PosX + begin, size * sizeof(float32));
+					memcpy(&PosY[offset], v.PosY + begin, size * sizeof(float32));
+					memcpy(&PosZ[offset], v.PosZ + begin, size * sizeof(float32));
+					memcpy(&Phase[offset], v.Phase + begin, size * sizeof(float32));
+					for (uint32 k = 0; k < size; k++)
+					{
+						Indices[offset + k] = begin + k;
+					}
+					offset += size;
+				}
+
+				// 2悪ɂȂĔaOƔ肳_Ŗ߂
+				for (uint32 k = Count; k < PaddedCount; k++)
+				{
+					PosX[k] = PosY[k] = PosZ[k] = std::numeric_limits<float32>::max();
+					Phase[k] = 0.f;
+					Indices[k] = UINT32_INVALID_NUM;
+				}
+
+				Range = range;
+				IsValid = true;
+			}
+		};
+
+		// [J[ƂɎg܂킷
+		thread_local CandidateBuffer Candidates;
+
+		void CoupleScalar(const CandidateBuffer& c, const CouplingQuery& q, CouplingSum& sum)
+		{
+			for (uint32 k = 0; k < c.Count; k++)
+			{
+				const float32 dx = c.PosX[k] - q.PosX;
+				const float32 dy = c.PosY[k] - q.PosY;
+				const float32 dz = c.PosZ[k] - q.PosZ;
+				const float32 distSquare = dx * dx + dy * dy + dz * dz;
+				if (c.Indices[k] == q.Self || distSquare > q.RadiusSquare)
+					continue;
+
+				sum.NeighborCount++;
+				sum.Total += FastSin(c.Phase[k] - q.Phase) * (q.Weight - distSquare * q.DistanceScale);
+			}
+		}
+
+#if USE_AVX2
+		using Math::SIMD::HorizontalSum;
+
+		AVX2_FUNCTION __m256 FastSinAVX2(__m256 x)
+		{
+			const __m256 signMask = _mm256_set1_ps(-0.f);
+			const __m256 twoPI = _mm256_set1_ps(Math::TWO_PI);
+			const __m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(InvTwoPI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			const __m256 r = _mm256_fnmadd_ps(k, twoPI, x);
+			const __m256 sign = _mm256_and_ps(r, signMask);
+			__m256 a = _mm256_andnot_ps(signMask, r);
+			a = _mm256_min_ps(a, _mm256_sub_ps(_mm256_set1_ps(Math::PI), a));
+			const __m256 a2 = _mm256_mul_ps(a, a);
+			__m256 y = _mm256_fmadd_ps(a2, _mm256_set1_ps(SinCoef9), _mm256_set1_ps(SinCoef7));
+			y = _mm256_fmadd_ps(a2, y, _mm256_set1_ps(SinCoef5));
+			y = _mm256_fmadd_ps(a2, y, _mm256_set1_ps(SinCoef3));
+			y = _mm256_fmadd_ps(a2, y, _mm256_set1_ps(SinCoef1));
+			return _mm256_xor_ps(_mm256_mul_ps(a, y), sign);
+		}
+
+		// 8܂Ƃ߂Ĕ肷(8̔{܂Ŗ߂Ă̂Œ[͂Ȃ)
+		AVX2_FUNCTION void CoupleAVX2(const CandidateBuffer& c, const CouplingQuery& q, CouplingSum& sum)
+		{
+			const __m256 px = _mm256_set1_ps(q.PosX);
+			const __m256 py = _mm256_set1_ps(q.PosY);
+			const __m256 pz = _mm256_set1_ps(q.PosZ);
+			const __m256 phase = _mm256_set1_ps(q.Phase);
+			const __m256 r2 = _mm256_set1_ps(q.RadiusSquare);
+			const __m256 weight = _mm256_set1_ps(q.Weight);
+			const __m256 distanceScale = _mm256_set1_ps(q.DistanceScale);
+			const __m256i self = _mm256_set1_epi32((int32)q.Self);
+			const __m256 one = _mm256_set1_ps(1.f);
+			__m256 total = _mm256_setzero_ps();
+			__m256 count = _mm256_setzero_ps();
+			__m256 found = _mm256_setzero_ps(); // ߖTƂ݂Ȃ[
+
+			for (uint32 k = 0; k < c.PaddedCount; k += 8)
+			{
+				const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(c.PosX.data() + k), px);
+				const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(c.PosY.data() + k), py);
+				const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(c.PosZ.data() + k), pz);
+				const __m256 distSquare = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+
+				const __m256 isSelf = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(c.Indices.data() + k)), self));
+				const __m256 mask = _mm256_andnot_ps(isSelf, _mm256_cmp_ps(distSquare, r2, _CMP_LE_OQ));
+				if (_mm256_testz_ps(mask, mask))
+					continue;
+
+				found = _mm256_or_ps(found, mask);
+				count = _mm256_add_ps(count, _mm256_and_ps(mask, one));
+				const __m256 w = _mm256_fnmadd_ps(distSquare, distanceScale, weight);
+				const __m256 s = FastSinAVX2(_mm256_sub_ps(_mm256_loadu_ps(c.Phase.data() + k), phase));
+				total = _mm256_add_ps(total, _mm256_and_ps(mask, _mm256_mul_ps(s, w)));
+			}
+
+			// ߖTΐZȂ
+			if (_mm256_testz_ps(found, found))
+				return;
+
+			sum.Total += HorizontalSum(total);
+			sum.NeighborCount += (uint64)HorizontalSum(count);
+		}
+#endif // USE_AVX2
+	}
+
+	void OscillatorKernel::Step(const OscillatorBuffer& src, const Spatial::SpatialHash* const grid, const OscillatorParams& params, float32 dt, OUT OscillatorBuffer& dst,
+								bool parallel)
+	{
+		assert(&src != &dst);
+		const uint32 count = src.Size();
+		const bool meanField = params.Mode == CouplingMode::MeanField;
+		assert(meanField || (grid && grid->Count() == count && params.NeighborRadius <= grid->CellSize()));
+
+		dst.Resize(count);
+		_RandomAngle.resize(count);
+		_ChunkStats.resize((count + ChunkSize - 1) / ChunkSize);
+		_ChunkOrderSums.resize(_ChunkStats.size());
+
+		// `N̋E̓Xbhɂ炸ŒȂ̂ŁAǂ̃XbhłʂɂȂ
+		const auto forEachChunk = [parallel, count](auto&& func)
+		{
+			if (parallel)
+			{
+				Thread::JobSystem::ParallelFor(count, ChunkSize, func);
+				return;
+			}
+			for (uint32 begin = 0; begin < count; begin += ChunkSize)
+			{
+				func(begin, std::min(begin + ChunkSize, count));
+			}
+		};
+
+		// _ɕς(`NƂɗ܂Ƃ߂Đ)
+		const uint32 frame = _Frame++;
+		forEachChunk([&](uint32 begin, uint32 end)
+		{
+			_Random.FillUniform(begin, end - begin, frame, 0, -Math::TWO_PI, Math::TWO_PI, &_RandomAngle[begin]);
+			for (uint32 i = begin; i < end; i++)
+			{
+				float32 angle = src.DirAngle[i] + _RandomAngle[i] * dt;
+				if (angle > Math::TWO_PI)
+				{
+					angle -= Math::TWO_PI;
+				}
+				else if (angle < 0)
+				{
+					angle += Math::TWO_PI;
+				}
+				dst.DirAngle[i] = angle;
+			}
+		});
+
+		// ϐ R * e^(i) = (1 / N) *  e^(i) ߂
+		// `NƂ̕aԂɑ̂ŁAǂ̃XbhłlɂȂ
+		forEachChunk([&](uint32 begin, uint32 end)
+		{
+			float64 sumCos = 0.0, sumSin = 0.0;
+			for (uint32 i = begin; i < end; i++)
+			{
+				sumCos += FastCos(src.Phase[i]);
+				sumSin += FastSin(src.Phase[i]);
+			}
+			_ChunkOrderSums[begin / ChunkSize] = { sumCos, sumSin };
+		});
+
+		float64 sumCos = 0.0, sumSin = 0.0;
+		for (const auto& [chunkCos, chunkSin] : _ChunkOrderSums)
+		{
+			sumCos += chunkCos;
+			sumSin += chunkSin;
+		}
+		const float64 invCount = count ? 1.0 / (float64)count : 0.0;
+		_OrderParameter = (float32)(sqrt(sumCos * sumCos + sumSin * sumSin) * invCount);
+		_MeanPhase = (count && _OrderParameter > 0.f) ? (float32)atan2(sumSin, sumCos) : 0.f;
+
+		const float32 width = params.WallRightX - params.WallLeftX;
+		const float32 depth = params.WallForwardZ - params.WallBackZ;
+
+		// ɂωtotalňʑXVAVɈړĎIEKp
+		const auto integrate = [&](uint32 i, float32 x, float32 y, float32 z, float32 phase, float32 total)
+		{
+			float32 newPhase = phase + (src.AngularFreq[i] + total) * dt;
+			if (newPhase > Math::TWO_PI)
+			{
+				newPhase -= Math::TWO_PI;
+			}
+			else if (newPhase < 0)
+			{
+				newPhase += Math::TWO_PI;
+			}
+			dst.Phase[i] = newPhase;
+			dst.AngularFreq[i] = src.AngularFreq[i];
+
+			float32 newX = x + params.Speed * cosf(dst.DirAngle[i]) * dt;
+			float32 newZ = z + params.Speed * sinf(dst.DirAngle[i]) * dt;
+			if (newX < params.WallLeftX)
+				newX += width;
+			if (params.WallRightX < newX)
+				newX -= width;
+			if (newZ < params.WallBackZ)
+				newZ += depth;
+			if (params.WallForwardZ < newZ)
+				newZ -= depth;
+			dst.PosX[i] = newX;
+			dst.PosY[i] = y;
+			dst.PosZ[i] = newZ;
+		};
+
+		if (meanField)
+		{
+			// S̏ꍇ (K / N) *  sin(j - i) = K * R * sin( - i) Ȃ̂ŋߖT𒲂ׂKvȂ
+			const float32 coupling = params.Weight * _OrderParameter;
+			forEachChunk([&](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; i++)
+				{
+					const float32 total = coupling * FastSin(_MeanPhase - src.Phase[i]);
+					integrate(i, src.PosX[i], src.PosY[i], src.PosZ[i], src.Phase[i], total);
+				}
+
+				Spatial::QueryStats stats{};
+				stats.QueryCount = end - begin;
+				_ChunkStats[begin / ChunkSize] = stats;
+			});
+		}
+		else
+		{
+			_SortedPhase.resize(count);
+			const uint32* const sortedIndices{ grid->SortedIndices() };
+			forEachChunk([&](uint32 begin, uint32 end)
+			{
+				for (uint32 k = begin; k < end; k++)
+				{
+					_SortedPhase[k] = src.Phase[sortedIndices[k]];
+				}
+			});
+
+			const SortedView view{ grid->SortedX(), grid->SortedY(), grid->SortedZ(), _SortedPhase.data() };
+			const float32 radiusSquare = params.NeighborRadius * params.NeighborRadius;
+			const float32 distanceScale = (params.DistanceAttenuation && radiusSquare > 0.f) ? params.Weight / radiusSquare : 0.f;
+#if USE_AVX2
+			const bool useAVX2 = Math::SIMD::IsAVX2Supported();
+#else
+			constexpr bool useAVX2 = false;
+#endif
+
+			forEachChunk([&](uint32 chunkBegin, uint32 chunkEnd)
+			{
+				Spatial::QueryStats stats{};
+				CandidateBuffer& candidates{ Candidates };
+				candidates.IsValid = false;
+				for (uint32 k = chunkBegin; k < chunkEnd; k++)
+				{
+					CouplingQuery q{};
+					q.PosX = view.PosX[k];
+					q.PosY = view.PosY[k];
+					q.PosZ = view.PosZ[k];
+					q.Phase = view.Phase[k];
+					q.Self = k;
+					q.RadiusSquare = radiusSquare;
+					q.Weight = params.Weight;
+					q.DistanceScale = distanceScale;
+
+					// ق̃IV[^[̏ԂʑXV
+					const Spatial::CellRange range{ grid->GetCellRange(q.PosX, q.PosY, q.PosZ, params.NeighborRadius) };
+					if (!candidates.IsValid || candidates.Range != range)
+					{
+						candidates.Gather(*grid, view, range);
+					}
+					stats.CandidateCount += candidates.Count;
+
+					CouplingSum sum{};
+#if USE_AVX2
+					if (useAVX2)
+					{
+						CoupleAVX2(candidates, q, sum);
+					}
+					else
+#endif
+					{
+						CoupleScalar(candidates, q, sum);
+					}
+					stats.NeighborCount += sum.NeighborCount;
+
+					integrate(sortedIndices[k], q.PosX, q.PosY, q.PosZ, q.Phase, sum.Total);
+				}
+				stats.QueryCount = chunkEnd - chunkBegin;
+				_ChunkStats[chunkBegin / ChunkSize] = stats;
+			});
+		}
+
+		_Stats = {};
+		for (const Spatial::QueryStats& stats : _ChunkStats)
+		{
+			_Stats += stats;
+		}
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "CommonHeaders.h"
+#include "Core/Utility/Spatial/SpatialHash.h"
+#include "Core/Utility/Thread/JobSystem.h"
+#include "Core/Utility/Math/Random.h"
+
+using namespace Rizityo;
+
+namespace Oscillator
+{
+	enum class CouplingMode : uint32
+	{
+		Local, // ߐڗ̈̃IV[^[Ƃ
+		MeanField, // SẴIV[^[ƌ(ϐgO(N)ŌvZ)
+
+		Count
+	};
+
+	struct OscillatorParams
+	{
+		CouplingMode Mode;
+		float32 Speed; // ړXs[h
+		float32 NeighborRadius; // ߐڗ̈̔a
+		float32 Weight; // ʑXV̏d
+		bool DistanceAttenuation; // d݂Ō邩ǂ(ߐڗ̈̋E0ɂȂ)
+
+		// IE
+		float32 WallLeftX;
+		float32 WallRightX;
+		float32 WallBackZ;
+		float32 WallForwardZ;
+	};
+
+	// IV[^[̏Ԃ𐬕Ƃ̔z(SoA)Ŏ
+	struct OscillatorBuffer
+	{
+		Vector<float32> PosX;
+		Vector<float32> PosY;
+		Vector<float32> PosZ;
+		Vector<float32> DirAngle; // ړ
+		Vector<float32> Phase;
+		Vector<float32> AngularFreq; // ŗLpU(ωȂ)
+
+		void Resize(uint32 count)
+		{
+			PosX.resize(count);
+			PosY.resize(count);
+			PosZ.resize(count);
+			DirAngle.resize(count);
+			Phase.resize(count);
+			AngularFreq.resize(count);
+		}
+
+		[[nodiscard]] uint32 Size() const { return (uint32)PosX.size(); }
+	};
+
+	// ߖT̃IV[^[Ƃ̈ʑ̌({f)ƃ_EH[N1Xebvi߂
+	// sin͑ŋߎAAVX2gꍇ͋ߖŤ8܂Ƃ߂ČvZ
+	class OscillatorKernel
+	{
+	public:
+
+		// ɏP
+		static constexpr uint32 ChunkSize = 256;
+
+		explicit OscillatorKernel(uint64 seed = 0) : _Random{ seed } {}
+
+		// ̃V[hςăt[ԍ0ɖ߂
+		void Reset(uint64 seed)
+		{
+			_Random = Math::CounterRNG{ seed };
+			_Frame = 0;
+		}
+
+		// srcǂdstɏȂ̂ŁAsrcdst͕ʂ̃obt@ɂ邱
+		// CouplingMode::Local̏ꍇAgridsrc̈ʒuĂKv(MeanField̏ꍇ͎gȂ̂nullptrł悢)
+		// paralleltrueȂChunkSizeƂJobSystemŕɏ(ʂ̓XbhɂȂ)
+		void Step(const OscillatorBuffer& src, const Spatial::SpatialHash* const grid, const OscillatorParams& params, float32 dt, OUT OscillatorBuffer& dst,
+				  bool parallel = false);
+
+		// OStepŋ߂src̒ϐ̑傫R(0: ΂΂ ` 1: Sɓ)ƕψʑ
+		[[nodiscard]] constexpr float32 OrderParameter() const { return _OrderParameter; }
+		[[nodiscard]] constexpr float32 MeanPhase() const { return _MeanPhase; }
+
+		// OStepł̋ߖTT̓v
+		[[nodiscard]] const Spatial::QueryStats& Stats() const { return _Stats; }
+
+	private:
+
+		// ړ̗(V[h, IV[^[̔ԍ, t[ԍ)Ō܂̂ŕɐł
+		Math::CounterRNG _Random;
+		uint32 _Frame = 0;
+		Vector<float32> _RandomAngle;
+		Vector<float32> _SortedPhase; // gridƓԂɕׂʑ
+		Vector<Spatial::QueryStats> _ChunkStats;
+		Vector<std::pair<float64, float64>> _ChunkOrderSums; // `NƂ̃cos, sin
+		Spatial::QueryStats _Stats;
+		float32 _OrderParameter = 0.f;
+		float32 _MeanPhase = 0.f;
+	};
+}
@@ -6,6 +6,8 @@
 #include "API/Input.h"
 #include "API/Light.h"
 #include "Oscillator.h"
+#include "OscillatorKernel.h"
+#include <random>
 
 using namespace Rizityo;
 
@@ -43,13 +45,20 @@ namespace
 
 	// IV[^[
 	GameEntity::Entity OscillatorEntities[OscillatorNum]{};
+	// Õt[̏Ԃǂłɏ݁AIւ
+	Oscillator::OscillatorBuffer OscillatorBuffers[2];
+	uint32 CurrentBuffer = 0;
+	Oscillator::OscillatorKernel Kernel;
+	Spatial::SpatialHash OscillatorGrid; // ߖTTp(t[蒼)
+	// ԂTransformW߂邽߂̍Ɨ̈
+	GameEntity::EntityID OscillatorEntityIDs[OscillatorNum]{};
 	Math::Vector3 OscillatorPositions[OscillatorNum]{};
-	float32 OscillatorPhases[OscillatorNum]{};
-	std::unordered_map<ID::IDType, uint32> OscillatorEntityID_IndexMapping;
 
 	float32 Speed = 2.f; // ړXs[h
 	float32 NeighborRadius = 4.f; // ߐڗ̈̔a(m)
 	float32 Weight = 1.f; // ʑXV̏d
+	bool DistanceAttenuation = false; // d݂Ō邩ǂ
+	Oscillator::CouplingMode Mode = Oscillator::CouplingMode::Local;
 	bool UpdateFlag = true;
 
 	// 
@@ -108,11 +117,38 @@ namespace
 		{
 			for (uint32 j = 0; j < OscillatorZNum; j++)
 			{
-				const GameEntity::Entity entity = GameEntity::Spawn("Oscillator", { IntervalScale * static_cast<float32>(i) - xOffset, 0.f, IntervalScale * static_cast<float32>(j) - zOffset });
-				OscillatorEntities[i * OscillatorZNum + j] = entity;
-				OscillatorEntityID_IndexMapping[entity.ID()] = i * OscillatorZNum + j;
+				OscillatorPositions[i * OscillatorZNum + j] = Math::Vector3{ IntervalScale * static_cast<float32>(i) - xOffset, 0.f, IntervalScale * static_cast<float32>(j) - zOffset };
 			}
 		}
+
+		GameEntity::SpawnMany(&OscillatorInfo, OscillatorNum, &OscillatorPositions[0], nullptr, &OscillatorEntities[0]);
+		for (uint32 i = 0; i < OscillatorNum; i++)
+		{
+			OscillatorEntityIDs[i] = OscillatorEntities[i].ID();
+			OscillatorEntities[i].GetScriptComponent().GetScript<OscillatorScript>()->SetIndex(i);
+		}
+
+		// Ԃ(ȍ~OscillatorBuffersƂȂ)
+		// V[hȂ瓯ԂƗɂȂ̂ŁAV[hL^Ă΍Čł
+		const uint64 seed = ((uint64)std::random_device{}() << 32) | std::random_device{}();
+		Kernel.Reset(seed);
+		const Math::CounterRNG random{ seed };
+
+		CurrentBuffer = 0;
+		Oscillator::OscillatorBuffer& state{ OscillatorBuffers[CurrentBuffer] };
+		state.Resize(OscillatorNum);
+		Transform::GetPositions(&OscillatorEntityIDs[0], OscillatorNum, &OscillatorPositions[0]);
+		for (uint32 i = 0; i < OscillatorNum; i++)
+		{
+			const Math::Vector3& pos{ OscillatorPositions[i] };
+			state.PosX[i] = pos.x;
+			state.PosY[i] = pos.y;
+			state.PosZ[i] = pos.z;
+			// 0̓J[lړ̍XVɎĝ1ȍ~g
+			state.DirAngle[i] = random.Uniform(i, 0, 1, 0.f, Math::TWO_PI);
+			state.Phase[i] = random.Uniform(i, 0, 2, 0.f, Math::TWO_PI);
+			state.AngularFreq[i] = random.Uniform(i, 0, 3, 0.f, Math::TWO_PI) / 4;
+		}
 	}
 
 	void RemoveOscillators()
@@ -194,39 +230,14 @@ namespace Oscillator
 		return &OscillatorEntities[0];
 	}
 
-	const Math::Vector3* const GetOscillatorPositions()
-	{
-		return &OscillatorPositions[0];
-	}
-
-	const float32* const GetOscillatorPhases()
-	{
-		return &OscillatorPhases[0];
-	}
-
-	uint32 GetEntityIndex(ID::IDType id)
+	void GetState(uint32 index, OUT Math::Vector3& position, OUT float32& phase)
 	{
-		return OscillatorEntityID_IndexMapping[id];
-	}
-
-	void ApplyWallCondition(OUT Math::Vector3& pos)
-	{
-		using namespace Math;
-
-		if (pos.x < WallLeftX)
-			pos.x += (WallRightX - WallLeftX);
-		if (WallRightX < pos.x)
-			pos.x -= (WallRightX - WallLeftX);
-		if (pos.z < WallBackZ)
-			pos.z += (WallForwardZ - WallBackZ);
-		if (WallForwardZ < pos.z)
-			pos.z -= (WallForwardZ - WallBackZ);
-
+		const Oscillator::OscillatorBuffer& state{ OscillatorBuffers[CurrentBuffer] };
+		assert(index < state.Size());
+		position = Math::Vector3{ state.PosX[index], state.PosY[index], state.PosZ[index] };
+		phase = state.Phase[index];
 	}
 
-	float32 GetSpeed() { return Speed; }
-	float32 GetNeighborRadius() { return NeighborRadius; }
-	float32 GetWeight() { return Weight; }
 	bool GetUpdateFlag() { return UpdateFlag; }
 }
 
@@ -238,13 +249,37 @@ void SynchroSimulation::Initialize()
 	SimUI.SetFlag(true);
 }
 
-void SynchroSimulation::Update()
+void SynchroSimulation::Update(float32 dt)
 {
-	for (uint32 i = 0; i < OscillatorNum; i++)
+	if (!UpdateFlag)
+		return;
+
+	const Oscillator::OscillatorBuffer& current{ OscillatorBuffers[CurrentBuffer] };
+	Oscillator::OscillatorBuffer& next{ OscillatorBuffers[CurrentBuffer ^ 1] };
+
+	// S̏ꍇ͋ߖT𒲂ׂȂ̂ŋԃnbVȂ
+	const bool local = Mode == Oscillator::CouplingMode::Local;
+	if (local)
 	{
-		OscillatorPositions[i] = OscillatorEntities[i].GetPosition();
-		OscillatorPhases[i] = OscillatorEntities[i].GetScriptComponent().GetScript<OscillatorScript>()->GetPhase();
+		// ZTCYߐڗ̈̔aɍ킹邱ƂŋߖT3x3Z𒲂ׂ΂悢
+		OscillatorGrid.Build(current.PosX.data(), current.PosY.data(), current.PosZ.data(), current.Size(), std::max(NeighborRadius, Math::EPSILON));
 	}
+
+	Oscillator::OscillatorParams params{};
+	params.Mode = Mode;
+	params.Speed = Speed;
+	params.NeighborRadius = NeighborRadius;
+	params.Weight = Weight;
+	params.DistanceAttenuation = DistanceAttenuation;
+	params.WallLeftX = WallLeftX;
+	params.WallRightX = WallRightX;
+	params.WallBackZ = WallBackZ;
+	params.WallForwardZ = WallForwardZ;
+
+	// SIV[^[SoÂ܂JobSystem̃[J[ŕSčXV
+	// Transformւ݂̏͑XNvg̍XVOscillatorScript::UpdateAlls
+	Kernel.Step(current, local ? &OscillatorGrid : nullptr, params, dt, next, true);
+	CurrentBuffer ^= 1;
 }
 
 void SynchroSimulation::Shutdown()
@@ -264,10 +299,22 @@ void SynchroSimulationGUI::ShowContent()
 		ImGui::SliderFloat("Speed", &Speed, 0.f, 5.f);
 		ImGui::SliderFloat("NeighborRadius", &NeighborRadius, 0.f, 5.f);
 		ImGui::SliderFloat("Weight", &Weight, 0.f, 5.f);
+		ImGui::Checkbox("Distance Attenuation", &DistanceAttenuation);
+
+		int32 mode = (int32)Mode;
+		ImGui::RadioButton("Local", &mode, (int32)Oscillator::CouplingMode::Local);
+		ImGui::SameLine();
+		ImGui::RadioButton("Mean Field", &mode, (int32)Oscillator::CouplingMode::MeanField);
+		Mode = (Oscillator::CouplingMode)mode;
 
 		ImGui::TreePop();
 	}
 
+	// ̓x(ϐ̑傫R)
+	const float32 order = Kernel.OrderParameter();
+	ImGui::Text("Order Parameter R = %.3f", order);
+	ImGui::ProgressBar(order, { -1.f, 0.f });
+
 	ImGui::Dummy({ 0.f, 20.f });
 
 	// X^[g/Xgbv
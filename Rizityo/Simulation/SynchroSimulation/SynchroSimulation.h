@@ -9,7 +9,7 @@ class SynchroSimulation : public Simulation
 {
 public:
 	void Initialize() override;
-	void Update() override;
+	void Update(float32 dt) override;
 	void Shutdown() override;
 };
 
@@ -17,15 +17,10 @@ namespace Oscillator
 {
 	uint32 GetOscillatorNum();
 	const GameEntity::Entity* const GetOscillatorEntity();
-	const Math::Vector3* const GetOscillatorPositions();
-	const float32* const GetOscillatorPhases();
-	uint32 GetEntityIndex(ID::IDType id);
 
-	void ApplyWallCondition(OUT Math::Vector3& pos);
+	// SynchroSimulation::UpdateŌvZŐV̏
+	void GetState(uint32 index, OUT Math::Vector3& position, OUT float32& phase);
 
-	float32 GetSpeed();
-	float32 GetNeighborRadius();
-	float32 GetWeight();
 	bool GetUpdateFlag();
 }
 